@@ -0,0 +1,190 @@
+/**
+ * Benchmark (Driver Cost Per Register Path)
+ *
+ * - Times the common calls with micros() at 100 kHz, 400 kHz and 1 MHz
+ * - Compares pointer cache on / off and config cache on / off
+ * - Restores the original configuration when done
+ *
+ * Instrumentation:
+ * - Build with -DTMP11X_ENABLE_TIMING (global build flag, e.g.
+ *   PlatformIO build_flags) to also print the driver's own counters:
+ *   transactions, failures, per-call us, pointer-cache and
+ *   config-cache statistics
+ *
+ * Notes:
+ * - Timings include Wire overhead of the board core
+ * - Not every board / sensor runs at 1 MHz; failures are reported
+ */
+
+#include <7Semi_TMP11x.h>
+
+#define BENCH_ADDRESS     0x48
+#define BENCH_ITERATIONS  200
+
+TMP11x_7Semi sensor(Wire);
+
+const uint32_t clocks[] = { 100000, 400000, 1000000 };
+
+uint16_t savedConfig = 0;
+uint32_t failures = 0;
+
+/* ================= Benchmarked Calls ================= */
+
+uint8_t benchReadTemperatureC() {
+  float tC;
+  return sensor.readTemperatureC(tC);
+}
+
+uint8_t benchReadRaw() {
+  int16_t raw;
+  return sensor.readRawTemperature(raw);
+}
+
+uint8_t benchReadConfig() {
+  uint16_t cfg;
+  return sensor.readConfig(cfg);
+}
+
+uint8_t benchWriteConfig() {
+  return sensor.writeConfig(savedConfig);
+}
+
+uint8_t benchSetAveraging() {
+  return sensor.setAveraging(AVG_8);
+}
+
+uint8_t benchGetAveraging() {
+  uint8_t avg;
+  return sensor.getAveraging(avg);
+}
+
+/**
+ * Run one call BENCH_ITERATIONS times and print the mean time.
+ */
+void bench(const char *name, uint8_t (*call)()) {
+  uint32_t failed = 0;
+  uint32_t start = micros();
+  for (uint16_t i = 0; i < BENCH_ITERATIONS; i++) {
+    if (!call())
+      failed++;
+  }
+  uint32_t elapsed = micros() - start;
+
+  failures += failed;
+  Serial.print("  ");
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print(elapsed / BENCH_ITERATIONS);
+  Serial.print(" us/call");
+  if (failed) {
+    Serial.print(" (");
+    Serial.print(failed);
+    Serial.print(" failed)");
+  }
+  Serial.println();
+}
+
+#ifdef TMP11X_ENABLE_TIMING
+/**
+ * Print and clear the driver's own counters.
+ */
+void printTimingStats() {
+  const TMP11x_TimingStats &t = sensor.getTimingStats();
+
+  Serial.print("  driver: reads ");
+  Serial.print(t.read.count);
+  Serial.print(" (avg ");
+  Serial.print(t.read.averageUs());
+  Serial.print(" us, max ");
+  Serial.print(t.read.maxUs);
+  Serial.print(" us, failed ");
+  Serial.print(t.read.failures);
+  Serial.println(")");
+
+  Serial.print("          writes ");
+  Serial.print(t.write.count);
+  Serial.print(" (avg ");
+  Serial.print(t.write.averageUs());
+  Serial.print(" us, max ");
+  Serial.print(t.write.maxUs);
+  Serial.print(" us, failed ");
+  Serial.print(t.write.failures);
+  Serial.println(")");
+
+  Serial.print("          pointer writes skipped ");
+  Serial.print(t.pointerSkips);
+  Serial.print(" / ");
+  Serial.println(t.pointerSkips + t.pointerWrites);
+
+  Serial.print("          config cache hits ");
+  Serial.print(t.cacheHits);
+  Serial.print(" / ");
+  Serial.println(t.cacheHits + t.cacheMisses);
+
+  sensor.resetTimingStats();
+}
+#endif
+
+/* ================= Benchmark Pass ================= */
+
+void runPass(uint32_t clock) {
+  Serial.print("I2C ");
+  Serial.print(clock / 1000);
+  Serial.println(" kHz");
+
+  if (!sensor.begin(BENCH_ADDRESS, 0xFF, 0xFF, clock)) {
+    Serial.println("  sensor not found at this clock");
+    return;
+  }
+
+  sensor.enableConfigCache(false);
+  sensor.enablePointerCache(false);
+  bench("readTemperatureC (no pointer cache)", benchReadTemperatureC);
+
+  sensor.enablePointerCache(true);
+  bench("readTemperatureC (pointer cache)   ", benchReadTemperatureC);
+  bench("readRawTemperature                 ", benchReadRaw);
+  bench("readConfig                         ", benchReadConfig);
+  bench("writeConfig                        ", benchWriteConfig);
+  bench("setAveraging (read-modify-write)   ", benchSetAveraging);
+  bench("getAveraging (bus)                 ", benchGetAveraging);
+
+  sensor.enableConfigCache(true);
+  bench("setAveraging (config cache)        ", benchSetAveraging);
+  bench("getAveraging (config cache)        ", benchGetAveraging);
+
+#ifdef TMP11X_ENABLE_TIMING
+  printTimingStats();
+#endif
+
+  sensor.writeConfig(savedConfig);
+  Serial.println();
+}
+
+void setup() {
+  Serial.begin(115200);
+  delay(500);
+
+  if (!sensor.begin(BENCH_ADDRESS) || !sensor.readConfig(savedConfig)) {
+    Serial.println("TMP11x not found!");
+    while (1) delay(100);
+  }
+  savedConfig &= TMP11X_CFG_WRITABLE_MASK;
+
+  Serial.print("TMP11x benchmark, ");
+  Serial.print(BENCH_ITERATIONS);
+  Serial.println(" calls per line");
+  Serial.println();
+
+  for (uint8_t i = 0; i < sizeof(clocks) / sizeof(clocks[0]); i++)
+    runPass(clocks[i]);
+
+  sensor.begin(BENCH_ADDRESS);
+  sensor.writeConfig(savedConfig);
+
+  Serial.print("Done, total failures: ");
+  Serial.println(failures);
+}
+
+void loop() {
+}
@@ -1,21 +1,29 @@
 /**
- * One Shot Read (Shutdown + One-Shot Read)
+ * One Shot Read (Shutdown + Non-Blocking One-Shot Read)
  *
  * - Keeps TMP11x in shutdown most of the time
  * - Triggers one-shot conversion only when needed
  * - Useful for battery-powered applications
  *
  * Notes:
- * - One-shot conversion time depends on:
- *   - Conversion rate setting
- *   - Averaging setting
- * - Use a small delay after one-shot before reading temperature
+ * - One-shot conversion time depends on the averaging setting
+ *   - AVG_NONE: ~15.5 ms, AVG_8: ~125 ms, AVG_32: ~500 ms, AVG_64: ~1 s
+ * - startOneShot() / poll() / fetch() never block
+ *   - poll() returns true once Data_Ready is set (or the deadline passes)
+ * - Device returns to shutdown by itself after the conversion
  */
 
 #include <7Semi_TMP11x.h>
 
 TMP11x_7Semi tmp(Wire);
 
+/**
+ * Sample interval in ms.
+ */
+static const uint32_t SAMPLE_INTERVAL_MS = 2000;
+
+uint32_t lastTrigger = 0;
+
 void setup() {
   Serial.begin(115200);
 
@@ -25,57 +33,52 @@ void setup() {
   }
 
   /**
-   * Optional: Choose a faster conversion for quicker one-shot.
-   * - CONV_125MS is a common fast-but-not-minimum option
+   * Keep a shadow copy of CONFIG.
+   * - startOneShot() is then a single CONFIG write
    */
-  tmp.setConversionRate(CONV_125MS);
+  tmp.enableConfigCache();
 
   /**
    * Optional: No averaging for fastest one-shot response.
+   * - Put device in shutdown for low power idle
    */
-  tmp.setAveraging(AVG_NONE);
-
-  /**
-   * Put device in shutdown for low power idle.
-   */
-  tmp.setMode(SHUTDOWN);
+  tmp.configure(TMP11x_Config()
+                  .withMode(SHUTDOWN)
+                  .withConversionRate(CONV_125MS)
+                  .withAveraging(AVG_NONE));
 
   Serial.println("One-shot mode demo ready");
+
+  tmp.startOneShot();
+  lastTrigger = millis();
 }
 
 void loop() {
   float tC = 0.0f;
 
   /**
-   * Trigger a one-shot conversion.
-   * - Device performs one conversion cycle
+   * Collect the result once the conversion is done.
    */
-  tmp.setMode(ONE_SHOT);
-
-  /**
-   * Wait for conversion to complete.
-   * - Tune this delay based on your conversion/averaging settings
-   */
-  delay(30);
-
-  /**
-   * Read temperature result.
-   */
-  if (tmp.readTemperatureC(tC)) {
-    Serial.print("One-shot Temp: ");
-    Serial.print(tC, 4);
-    Serial.println(" C");
-  } else {
-    Serial.println("One-shot read failed");
+  if (tmp.poll()) {
+    if (tmp.fetch(tC)) {
+      Serial.print("One-shot Temp: ");
+      Serial.print(tC, 4);
+      Serial.println(" C");
+    } else {
+      Serial.println("One-shot read failed");
+    }
   }
 
   /**
-   * Return to shutdown to save power.
+   * Trigger the next conversion every SAMPLE_INTERVAL_MS.
    */
-  tmp.setMode(SHUTDOWN);
+  if (millis() - lastTrigger >= SAMPLE_INTERVAL_MS) {
+    lastTrigger = millis();
+    if (!tmp.startOneShot())
+      Serial.println("One-shot trigger failed");
+  }
 
   /**
-   * Sample every 2 seconds.
+   * Other work (radio, other sensors, sleep) can run here.
    */
-  delay(2000);
 }
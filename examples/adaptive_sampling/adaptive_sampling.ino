@@ -0,0 +1,51 @@
+/**
+ * Adaptive Sampling (Slow When Flat, Fast When Changing)
+ *
+ * - Flat temperature: CONV_4S / AVG_8
+ * - Changing (> 50 m°C/s) or outside +-0.25 °C of the last value:
+ *   CONV_125MS / AVG_8
+ * - Returns to slow after 5 s below 20 m°C/s
+ */
+
+#include <7Semi_TMP11x.h>
+#include <7Semi_TMP11x_Adaptive.h>
+
+TMP11x_7Semi sensor(Wire);
+TMP11x_Adaptive adaptive(sensor);
+
+bool wasFast = false;
+
+void setup() {
+  Serial.begin(115200);
+
+  if (!sensor.begin(0x48)) {
+    Serial.println("TMP11x not found!");
+    while (1) delay(100);
+  }
+
+  if (!adaptive.begin()) {
+    Serial.println("Adaptive setup failed!");
+    while (1) delay(100);
+  }
+
+  sensor.addSampleSink(adaptive);
+}
+
+void loop() {
+  float temperatureC;
+
+  if (sensor.readTemperatureIfReady(temperatureC)) {
+    Serial.print("Temp: ");
+    Serial.print(temperatureC, 4);
+    Serial.print(" C  slope: ");
+    Serial.print(adaptive.stats().slopeMilliCPerS());
+    Serial.println(" mC/s");
+  }
+
+  if (adaptive.isFast() != wasFast) {
+    wasFast = adaptive.isFast();
+    Serial.println(wasFast ? "-> fast" : "-> slow");
+  }
+
+  delay(20);
+}
@@ -0,0 +1,59 @@
+/**
+ * Alert Window (Interrupt Driven, With Hysteresis)
+ *
+ * - Window 20 °C .. 35 °C with 0.5 °C hysteresis
+ * - ALERT edge is caught by interrupt; no polling of the sensor
+ * - service() reads CONFIG once and tells which limit tripped
+ *
+ * Wiring:
+ * - TMP11x ALERT -> ALERT_GPIO (open drain, internal pull-up is enabled)
+ */
+
+#include <7Semi_TMP11x.h>
+#include <7Semi_TMP11x_Alert.h>
+
+TMP11x_7Semi tmp(Wire);
+TMP11x_AlertWindow alerts(tmp);
+
+/**
+ * Change this to your board GPIO connected to TMP11x ALERT pin.
+ */
+static const int ALERT_GPIO = 2;
+
+void onHigh(uint32_t timestampMs) {
+  Serial.print(timestampMs);
+  Serial.println(" ms: above 35 C");
+}
+
+void onLow(uint32_t timestampMs) {
+  Serial.print(timestampMs);
+  Serial.println(" ms: below 20 C");
+}
+
+void onClear(uint32_t timestampMs) {
+  Serial.print(timestampMs);
+  Serial.println(" ms: back inside window");
+}
+
+void setup() {
+  Serial.begin(115200);
+
+  if (!tmp.begin(0x48)) {
+    Serial.println("TMP11x not found!");
+    while (1) delay(100);
+  }
+
+  alerts.onHigh(onHigh);
+  alerts.onLow(onLow);
+  alerts.onClear(onClear);
+
+  if (!alerts.beginWindow(ALERT_GPIO, 20000, 35000, 500)) {
+    Serial.println("Alert setup failed!");
+    while (1) delay(100);
+  }
+}
+
+void loop() {
+  /* No bus traffic unless the ALERT pin fired */
+  alerts.service();
+}
@@ -0,0 +1,65 @@
+/**
+ * Multi-Point Calibration
+ *
+ * - Three reference points (e.g. from a calibrated bath / reference probe)
+ * - fit() splits the correction:
+ *   - constant term -> TEMP_OFFSET (device applies it)
+ *   - gain / shape -> integer piecewise-linear correction on each sample
+ * - setCalibration() applies it to every read
+ * - Two-point (linear) calibrations can be stored in the sensor itself
+ *   with saveToEEPROM() and restored with loadFromEEPROM()
+ */
+
+#include <7Semi_TMP11x.h>
+#include <7Semi_TMP11x_Calibration.h>
+
+TMP11x_7Semi sensor(Wire);
+TMP11x_Calibration calibration;
+
+/**
+ * Raw codes read from the sensor (offset 0, no calibration set)
+ * and the reference temperatures at the same moments (m°C).
+ */
+const int16_t measuredRaw[3] = { 13, 6438, 12826 };
+const int32_t referenceMilliC[3] = { 0, 50000, 100000 };
+
+uint8_t blob[TMP11X_CAL_BLOB_SIZE];
+
+void setup() {
+  Serial.begin(115200);
+
+  if (!sensor.begin(0x48)) {
+    Serial.println("TMP11x not found!");
+    while (1) delay(100);
+  }
+
+  if (!calibration.fit(measuredRaw, referenceMilliC, 3)) {
+    Serial.println("Invalid reference points!");
+    while (1) delay(100);
+  }
+
+  calibration.applyOffset(sensor);
+  sensor.setCalibration(&calibration);
+
+  /**
+   * Keep the coefficients in your own storage (flash / FRAM / NVS).
+   */
+  uint8_t length = calibration.toBlob(blob, sizeof(blob));
+  Serial.print("Calibration blob: ");
+  Serial.print(length);
+  Serial.println(" bytes");
+
+  Serial.print("Hardware offset: ");
+  Serial.print(TMP11x_rawToMilliC(calibration.offsetRaw()));
+  Serial.println(" mC");
+}
+
+void loop() {
+  int32_t milliC;
+  if (sensor.readTemperatureMilliC(milliC)) {
+    Serial.print("Calibrated: ");
+    Serial.print(milliC);
+    Serial.println(" mC");
+  }
+  delay(1000);
+}
@@ -3,7 +3,7 @@
  *
  * - Sets conversion cycle to 1s
  * - Enables averaging (32 samples)
- * - Reads temperature continuously
+ * - Reads temperature continuously, only when a new result is ready
  *
  * Why this helps:
  * - Averaging reduces noise/jitter in readings
@@ -30,14 +30,17 @@ void setup() {
    *
    * - Averaging option:
    *   - AVG_32: averages 32 conversions internally
+   *
+   * - Mode:
+   *   - CONTINUOUS_0: keep device in continuous mode
+   *
+   * - configure() writes all fields in a single CONFIG write
    */
-  tmp.setConversionRate(CONV_1S);
-  tmp.setAveraging(AVG_32);
-
-  /**
-   * Keep device in continuous mode.
-   */
-  tmp.setMode(CONTINUOUS_0);
+  constexpr TMP11x_Config cfg = TMP11x_Config()
+                                  .withMode(CONTINUOUS_0)
+                                  .withConversionRate(CONV_1S)
+                                  .withAveraging(AVG_32);
+  tmp.configure(cfg);
 
   Serial.println("Configured: CONV=1s, AVG=32, MODE=continuous");
 }
@@ -46,15 +49,14 @@ void loop() {
   float tC = 0.0f;
 
   /**
-   * Read temperature.
-   * - Even if loop runs faster, sensor updates based on conversion settings
+   * Read temperature only when a new conversion is available.
+   * - Loop runs faster than the 1 s conversion cycle
+   * - Data_Ready is checked first, so stale results are skipped
    */
-  if (tmp.readTemperatureC(tC)) {
+  if (tmp.readTemperatureIfReady(tC)) {
     Serial.print("Temp: ");
     Serial.print(tC, 4);
     Serial.println(" C");
-  } else {
-    Serial.println("Read failed");
   }
 
   delay(250);
@@ -0,0 +1,57 @@
+/**
+ * Custom Bus Transport
+ *
+ * - Runs the driver over a user-supplied I2C implementation
+ * - MyBus shows the two methods a bus policy needs; replace the bodies
+ *   with your HAL / DMA driver calls
+ * - Here MyBus forwards to TMP11x_MockBus, so the sketch runs without
+ *   a sensor attached
+ */
+
+#include <7Semi_TMP11x.h>
+#include <7Semi_TMP11x_Transport.h>
+#include <7Semi_TMP11x_MockBus.h>
+
+/**
+ * Example bus policy.
+ */
+class MyBus {
+public:
+  TMP11x_Status readRegister(uint8_t address, uint8_t reg, bool sendPointer, uint16_t &value) {
+    /* HAL: if sendPointer, write reg; then read 2 bytes MSB first */
+    return backend.readRegister(address, reg, sendPointer, value);
+  }
+
+  TMP11x_Status writeRegister(uint8_t address, uint8_t reg, uint16_t value) {
+    /* HAL: write reg, value >> 8, value & 0xFF */
+    return backend.writeRegister(address, reg, value);
+  }
+
+  TMP11x_MockBus backend;
+};
+
+MyBus bus;
+TMP11x_PolicyTransport<MyBus> transport(bus);
+TMP11x_7Semi sensor(transport);
+
+void setup() {
+  Serial.begin(115200);
+
+  if (!sensor.begin(0x48)) {
+    Serial.println("TMP11x not found!");
+    while (1) delay(100);
+  }
+
+  /* 25.0 °C in the mock */
+  bus.backend.setTemperatureRaw(3200);
+}
+
+void loop() {
+  int32_t milliC;
+  if (sensor.readTemperatureMilliC(milliC)) {
+    Serial.print("Temp: ");
+    Serial.print(milliC);
+    Serial.println(" mC");
+  }
+  delay(1000);
+}
@@ -0,0 +1,74 @@
+/**
+ * Data Ready Interrupt (ALERT pin as Data_Ready)
+ *
+ * - Routes Data_Ready to the ALERT pin (CONFIG DR/Alert = 1)
+ * - MCU interrupt fires when a new conversion completes
+ * - service() in loop() reads the sample, no bus polling in between
+ *
+ * Wiring:
+ * - ALERT -> MCU interrupt-capable GPIO
+ * - ALERT is open-drain: internal pull-up is enabled, add external if needed
+ *
+ * Notes:
+ * - ISR only timestamps and flags; I2C happens in service()
+ * - The MCU can sleep between samples and wake on the ALERT edge
+ */
+
+#include <7Semi_TMP11x.h>
+
+TMP11x_7Semi tmp(Wire);
+
+/**
+ * Change this to your board GPIO connected to TMP11x ALERT pin.
+ * - Example for ESP32: 4, 5, 18, etc.
+ * - Example for UNO: 2, 3
+ */
+static const uint8_t ALERT_GPIO = 2;
+
+/**
+ * Called from service() for every new sample.
+ */
+void onSample(int16_t raw, uint32_t timestampMs) {
+  Serial.print("[");
+  Serial.print(timestampMs);
+  Serial.print(" ms] Temp: ");
+  Serial.print(raw * 0.0078125f, 4);
+  Serial.println(" C");
+}
+
+void setup() {
+  Serial.begin(115200);
+
+  if (!tmp.begin(0x49)) {
+    Serial.println("TMP11x not found!");
+    while (1) delay(100);
+  }
+
+  tmp.enableConfigCache();
+
+  /**
+   * Continuous conversion, 1 s cycle, 8 averages.
+   */
+  tmp.configure(TMP11x_Config()
+                  .withMode(CONTINUOUS_0)
+                  .withConversionRate(CONV_1S)
+                  .withAveraging(AVG_8));
+
+  if (!tmp.attachDataReadyInterrupt(ALERT_GPIO, onSample)) {
+    Serial.println("Interrupt setup failed!");
+    while (1) delay(100);
+  }
+
+  Serial.println("Waiting for Data_Ready interrupts");
+}
+
+void loop() {
+  /**
+   * Fetch the sample only when the ISR flagged one.
+   */
+  tmp.service();
+
+  /**
+   * Other work or MCU sleep can go here.
+   */
+}
@@ -0,0 +1,57 @@
+/**
+ * Deep-Sleep Wake with quickBegin() (ESP32)
+ *
+ * - Cold boot: full begin(), configure, start one-shots
+ * - Warm wake: quickBegin() restores driver state from RTC memory,
+ *   no probing / CONFIG reads
+ * - Sensor stays powered while the ESP32 sleeps
+ */
+
+#include <7Semi_TMP11x.h>
+
+#if !defined(ESP32)
+#error "This example requires an ESP32"
+#endif
+
+#define SLEEP_SECONDS 10
+
+TMP11x_7Semi sensor(Wire);
+
+RTC_DATA_ATTR TMP11x_RetainedState retained;
+
+void setup() {
+  Serial.begin(115200);
+
+  if (!sensor.quickBegin(retained)) {
+    /* Cold boot (or retained state lost) */
+    if (!sensor.begin(0x48)) {
+      Serial.println("TMP11x not found!");
+      esp_deep_sleep(SLEEP_SECONDS * 1000000ULL);
+    }
+
+    sensor.enableConfigCache();
+    sensor.configure(TMP11x_Config().withMode(SHUTDOWN).withAveraging(AVG_8));
+
+    Serial.print("Model: TMP");
+    Serial.print(sensor.deviceModel(), HEX);
+    Serial.print(" rev ");
+    Serial.println(sensor.deviceRevision());
+  }
+
+  float temperatureC;
+  if (sensor.startOneShot()) {
+    while (!sensor.poll())
+      ;
+    if (sensor.fetch(temperatureC)) {
+      Serial.print("Temp: ");
+      Serial.print(temperatureC, 4);
+      Serial.println(" °C");
+    }
+  }
+
+  sensor.retainState(retained);
+  esp_deep_sleep(SLEEP_SECONDS * 1000000ULL);
+}
+
+void loop() {
+}
@@ -0,0 +1,63 @@
+/**
+ * ESP32 Background Acquisition Task
+ *
+ * - I2C sampling runs in a FreeRTOS task pinned to core 0
+ * - loop() (core 1) drains timestamped samples in batches once per second
+ * - latest() reads the newest value without waiting or touching I2C
+ * - ESP32 only
+ */
+
+#include <7Semi_TMP11x.h>
+#include <7Semi_TMP11x_ESP32.h>
+
+#if !defined(ESP32)
+#error "This example requires an ESP32"
+#endif
+
+TMP11x_7Semi sensor(Wire);
+TMP11x_AcquisitionTask acquisition;
+
+TMP11x_TaggedSample batch[16];
+
+void setup() {
+  Serial.begin(115200);
+
+  if (!sensor.begin(0x48)) {
+    Serial.println("TMP11x not found!");
+    while (1) delay(100);
+  }
+
+  sensor.enableConfigCache();
+  sensor.configure(TMP11x_Config().withMode(SHUTDOWN).withAveraging(AVG_8));
+
+  acquisition.add(sensor, 200, SCHED_ONE_SHOT);
+
+  if (!acquisition.start(0)) {
+    Serial.println("Task start failed!");
+    while (1) delay(100);
+  }
+}
+
+void loop() {
+  uint16_t n;
+
+  while ((n = acquisition.drain(batch, 16)) > 0) {
+    for (uint16_t i = 0; i < n; i++) {
+      Serial.print("[");
+      Serial.print(batch[i].timestampMs);
+      Serial.print(" ms] ");
+      Serial.print(TMP11x_rawToMilliC(batch[i].raw));
+      Serial.println(" mC");
+    }
+  }
+
+  TMP11x_TaggedSample last;
+  if (acquisition.latest(0, last)) {
+    Serial.print("Latest: ");
+    Serial.print(TMP11x_rawToMilliC(last.raw));
+    Serial.print(" mC, dropped: ");
+    Serial.println(acquisition.dropped());
+  }
+
+  delay(1000);
+}
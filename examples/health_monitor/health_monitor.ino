@@ -0,0 +1,68 @@
+/**
+ * Sensor Health Monitor
+ *
+ * - Flags stuck readings, stalled conversions, rising bus error rate
+ *   and likely self-heating
+ * - Recovers the bus automatically when the error rate is high
+ * - Prints the health summary every 5 s
+ */
+
+#include <7Semi_TMP11x.h>
+#include <7Semi_TMP11x_Health.h>
+
+TMP11x_7Semi tmp(Wire);
+
+/**
+ * Stuck after 64 identical codes, stalled after 5 s without data,
+ * bus errors above 5 % over 64 attempts, auto recovery every >= 10 s.
+ */
+TMP11x_Health health(tmp, TMP11x_HealthSettings(64, 5000, 64, 50, 125, 30, 10000, true, 10000));
+
+uint32_t lastReport = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  if (!tmp.begin(0x48)) {
+    Serial.println("TMP11x not found!");
+    while (1) delay(100);
+  }
+
+  tmp.setRetryPolicy(TMP11x_RetryPolicy(2, 100));
+  tmp.configure(TMP11x_Config()
+                  .withMode(CONTINUOUS_0)
+                  .withConversionRate(CONV_1S)
+                  .withAveraging(AVG_8));
+
+  tmp.addSampleSink(health);
+}
+
+void loop() {
+  tmp.service();
+  health.check();
+
+  if (millis() - lastReport < 5000)
+    return;
+  lastReport = millis();
+
+  TMP11x_HealthReport r;
+  health.report(r);
+
+  Serial.print("health 0x");
+  Serial.print(r.flags, HEX);
+  if (r.flags & TMP11X_HEALTH_STUCK)
+    Serial.print(" STUCK");
+  if (r.flags & TMP11X_HEALTH_STALLED)
+    Serial.print(" STALLED");
+  if (r.flags & TMP11X_HEALTH_BUS_ERRORS)
+    Serial.print(" BUS_ERRORS");
+  if (r.flags & TMP11X_HEALTH_SELF_HEATING)
+    Serial.print(" SELF_HEATING");
+
+  Serial.print(" | errors ");
+  Serial.print(r.errorPermille);
+  Serial.print(" permille, stuck run ");
+  Serial.print(r.stuckRun);
+  Serial.print(", recoveries ");
+  Serial.println(r.recoveries);
+}
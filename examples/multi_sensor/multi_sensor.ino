@@ -0,0 +1,70 @@
+/**
+ * Multi Sensor (Up To Four TMP11x On One Bus)
+ *
+ * - Initializes Wire once and probes 0x48..0x4B
+ * - Applies one configuration to every sensor found
+ * - Triggers synchronized one-shots, conversions overlap
+ * - Reports worst-case trigger skew between sensors
+ * - Collects each result as soon as it is ready
+ *
+ * Possible I2C addresses (based on ADDR pin):
+ * - 0x48 : ADDR = GND
+ * - 0x49 : ADDR = VDD
+ * - 0x4A : ADDR = SDA
+ * - 0x4B : ADDR = SCL
+ */
+
+#include <7Semi_TMP11x.h>
+#include <7Semi_TMP11x_Bus.h>
+
+TMP11x_Bus bus(Wire);
+
+void setup() {
+  Serial.begin(115200);
+
+  uint8_t found = bus.begin();
+  if (found == 0) {
+    Serial.println("No TMP11x found!");
+    while (1) delay(100);
+  }
+
+  Serial.print("Found ");
+  Serial.print(found);
+  Serial.println(" sensor(s)");
+
+  /**
+   * Shutdown between one-shots, 8 averages (~125 ms per conversion).
+   */
+  bus.configureAll(TMP11x_Config()
+                     .withMode(SHUTDOWN)
+                     .withAveraging(AVG_8));
+
+  bus.startOneShotSynchronized();
+}
+
+void loop() {
+  /**
+   * poll() returns true once every sensor has delivered its result.
+   */
+  if (bus.poll()) {
+    for (uint8_t i = 0; i < bus.count(); i++) {
+      float tC;
+      Serial.print("0x");
+      Serial.print(bus.address(i), HEX);
+      Serial.print(": ");
+      if (bus.getTemperatureC(i, tC)) {
+        Serial.print(tC, 4);
+        Serial.println(" C");
+      } else {
+        Serial.println("read failed");
+      }
+    }
+
+    Serial.print("Trigger skew: ");
+    Serial.print(bus.lastSkewUs());
+    Serial.println(" us");
+
+    delay(1000);
+    bus.startOneShotSynchronized();
+  }
+}
@@ -0,0 +1,52 @@
+/**
+ * Power-On Profile (Verify and Skip)
+ *
+ * - The TMP117 loads CONFIG / limits / offset from EEPROM at power-on
+ * - begin(profile) reads them once and compares with the expected profile
+ * - Only differing fields are written (and persisted), so normal boots
+ *   cost four register reads and no EEPROM wear
+ */
+
+#include <7Semi_TMP11x.h>
+
+TMP11x_7Semi sensor(Wire);
+
+/**
+ * Expected power-on state: 4 s conversions, 32x averaging,
+ * alert window 0 .. 45 °C, +0.1 °C offset.
+ */
+const TMP11x_Profile profile = TMP11x_Profile(TMP11x_Config()
+                                                .withConversionRate(CONV_4S)
+                                                .withAveraging(AVG_32))
+                                 .withHighLimitMilliC(45000)
+                                 .withLowLimitMilliC(0)
+                                 .withOffsetMilliC(100);
+
+void setup() {
+  Serial.begin(115200);
+
+  if (!sensor.begin(profile, 0x48)) {
+    Serial.print("Profile check failed, error ");
+    Serial.println(sensor.lastError());
+    while (1) delay(100);
+  }
+
+  /**
+   * Report what a second check would change (nothing after begin()).
+   */
+  uint8_t mismatches;
+  if (sensor.verifyProfile(profile, false, mismatches)) {
+    Serial.print("Mismatched fields: 0x");
+    Serial.println(mismatches, HEX);
+  }
+}
+
+void loop() {
+  int32_t milliC;
+  if (sensor.readTemperatureMilliC(milliC)) {
+    Serial.print("Temp: ");
+    Serial.print(milliC);
+    Serial.println(" mC");
+  }
+  delay(4000);
+}
@@ -0,0 +1,66 @@
+/**
+ * Ring Buffer (Buffered Samples + Batch Drain)
+ *
+ * - Stores raw samples with timestamps in a fixed-size ring buffer
+ * - service() fills the buffer whenever Data_Ready reports a new sample
+ * - Every 10 s the whole batch is drained and printed at once
+ *
+ * Notes:
+ * - 4 bytes per sample (raw code + timestamp delta), no heap
+ * - Replace the print loop with a radio upload for burst transmission
+ */
+
+#include <7Semi_TMP11x.h>
+#include <7Semi_TMP11x_RingBuffer.h>
+
+TMP11x_7Semi tmp(Wire);
+
+/**
+ * 32 samples, 1 ms timestamp resolution.
+ */
+TMP11x_RingBuffer<32> samples;
+
+TMP11x_Sample batch[32];
+
+uint32_t lastDrain = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  if (!tmp.begin(0x49)) {
+    Serial.println("TMP11x not found!");
+    while (1) delay(100);
+  }
+
+  tmp.configure(TMP11x_Config()
+                  .withMode(CONTINUOUS_0)
+                  .withConversionRate(CONV_500MS)
+                  .withAveraging(AVG_8));
+
+  tmp.addSampleSink(samples);
+}
+
+void loop() {
+  /**
+   * Collect new samples into the ring buffer.
+   */
+  tmp.service();
+
+  if (millis() - lastDrain >= 10000) {
+    lastDrain = millis();
+
+    uint16_t n = samples.drain(batch, 32);
+    Serial.print("Batch of ");
+    Serial.print(n);
+    Serial.println(" samples:");
+
+    for (uint16_t i = 0; i < n; i++) {
+      Serial.print(batch[i].timestampMs);
+      Serial.print(" ms: ");
+      Serial.print(TMP11x_rawToMilliC(batch[i].raw));
+      Serial.println(" mC");
+    }
+  }
+
+  delay(50);
+}
@@ -0,0 +1,77 @@
+/**
+ * Scheduler (Several Sensors, Individual Periods, No Blocking)
+ *
+ * - Sensor at 0x48: shutdown + one-shot every 1 s
+ * - Sensor at 0x49: continuous conversion, read every 250 ms
+ * - One tick(millis()) call drives everything
+ * - Prints late / missed counters every 10 s
+ */
+
+#include <7Semi_TMP11x.h>
+#include <7Semi_TMP11x_Scheduler.h>
+
+TMP11x_7Semi slowSensor(Wire);
+TMP11x_7Semi fastSensor(Wire);
+
+TMP11x_Scheduler scheduler;
+
+uint32_t lastReport = 0;
+
+/**
+ * Called for every delivered sample.
+ */
+void onSample(uint8_t id, int16_t raw, uint32_t timestampMs) {
+  Serial.print("[");
+  Serial.print(timestampMs);
+  Serial.print(" ms] sensor ");
+  Serial.print(id);
+  Serial.print(": ");
+  Serial.print(TMP11x_rawToMilliC(raw));
+  Serial.println(" mC");
+}
+
+void setup() {
+  Serial.begin(115200);
+
+  /**
+   * First sensor initializes the bus, second only attaches.
+   */
+  if (!slowSensor.begin(0x48) || !fastSensor.attach(0x49)) {
+    Serial.println("TMP11x not found!");
+    while (1) delay(100);
+  }
+
+  slowSensor.enableConfigCache();
+  slowSensor.configure(TMP11x_Config().withMode(SHUTDOWN).withAveraging(AVG_8));
+
+  fastSensor.enableConfigCache();
+  fastSensor.configure(TMP11x_Config()
+                         .withMode(CONTINUOUS_0)
+                         .withConversionRate(CONV_250MS)
+                         .withAveraging(AVG_NONE));
+
+  scheduler.add(slowSensor, 1000, SCHED_ONE_SHOT);
+  scheduler.add(fastSensor, 250, SCHED_CONTINUOUS);
+  scheduler.setCallback(onSample);
+  scheduler.start(millis());
+}
+
+void loop() {
+  scheduler.tick(millis());
+
+  if (millis() - lastReport >= 10000) {
+    lastReport = millis();
+
+    for (uint8_t i = 0; i < scheduler.count(); i++) {
+      const TMP11x_SchedulerStats &s = scheduler.getStats(i);
+      Serial.print("sensor ");
+      Serial.print(i);
+      Serial.print(": samples=");
+      Serial.print(s.samples);
+      Serial.print(" late=");
+      Serial.print(s.late);
+      Serial.print(" missed=");
+      Serial.println(s.missed);
+    }
+  }
+}
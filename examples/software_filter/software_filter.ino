@@ -0,0 +1,57 @@
+/**
+ * Software Filter (Fast Conversions + MCU Filtering)
+ *
+ * - Runs the sensor at its fastest cycle (CONV_15P5MS, AVG_NONE)
+ * - Median-of-5 rejects single-sample spikes
+ * - Filtered value responds to steps in tens of ms instead of ~1 s (AVG_64)
+ *
+ * Notes:
+ * - Fast continuous conversion raises sensor current and self-heating
+ * - FILTER_BOXCAR or FILTER_IIR can be selected instead
+ */
+
+#include <7Semi_TMP11x.h>
+#include <7Semi_TMP11x_Filter.h>
+
+TMP11x_7Semi tmp(Wire);
+
+/**
+ * Median over the last 5 samples.
+ */
+TMP11x_Filter<5> filter(FILTER_MEDIAN);
+
+uint32_t lastPrint = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  if (!tmp.begin(0x49)) {
+    Serial.println("TMP11x not found!");
+    while (1) delay(100);
+  }
+
+  tmp.configure(TMP11x_Config()
+                  .withMode(CONTINUOUS_0)
+                  .withConversionRate(CONV_15P5MS)
+                  .withAveraging(AVG_NONE));
+
+  tmp.addSampleSink(filter);
+}
+
+void loop() {
+  /**
+   * Feed every new conversion into the filter.
+   */
+  tmp.service();
+
+  if (millis() - lastPrint >= 200) {
+    lastPrint = millis();
+
+    float tC;
+    if (filter.readFiltered(tC)) {
+      Serial.print("Filtered: ");
+      Serial.print(tC, 4);
+      Serial.println(" C");
+    }
+  }
+}
@@ -0,0 +1,67 @@
+/**
+ * Streaming Statistics (Settling Detection)
+ *
+ * - Feeds every new sample into an incremental statistics accumulator
+ * - Prints mean / standard deviation / min / max / EMA in milli-degrees
+ * - Reports when readings have settled (std dev below a threshold)
+ *
+ * Notes:
+ * - Statistics are updated in O(1) per sample, no sample history is kept
+ * - Integer math only
+ */
+
+#include <7Semi_TMP11x.h>
+#include <7Semi_TMP11x_Stats.h>
+
+TMP11x_7Semi tmp(Wire);
+
+/**
+ * EMA weight 1/8.
+ */
+TMP11x_Stats stats(3);
+
+/**
+ * Settled when std dev <= 10 m°C over at least 20 samples.
+ */
+static const uint32_t SETTLE_STDDEV_MC = 10;
+static const uint32_t SETTLE_MIN_SAMPLES = 20;
+
+void setup() {
+  Serial.begin(115200);
+
+  if (!tmp.begin(0x49)) {
+    Serial.println("TMP11x not found!");
+    while (1) delay(100);
+  }
+
+  tmp.configure(TMP11x_Config()
+                  .withMode(CONTINUOUS_0)
+                  .withConversionRate(CONV_250MS)
+                  .withAveraging(AVG_8));
+
+  tmp.addSampleSink(stats);
+}
+
+void loop() {
+  if (!tmp.service())
+    return;
+
+  Serial.print("n=");
+  Serial.print(stats.count());
+  Serial.print(" mean=");
+  Serial.print(stats.meanMilliC());
+  Serial.print(" sd=");
+  Serial.print(stats.stdDevMilliC());
+  Serial.print(" min=");
+  Serial.print(stats.minMilliC());
+  Serial.print(" max=");
+  Serial.print(stats.maxMilliC());
+  Serial.print(" ema=");
+  Serial.print(stats.emaMilliC());
+  Serial.println(" (mC)");
+
+  if (stats.isSettled(SETTLE_STDDEV_MC, SETTLE_MIN_SAMPLES)) {
+    Serial.println("Settled");
+    stats.resetStats();
+  }
+}
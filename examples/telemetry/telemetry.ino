@@ -0,0 +1,72 @@
+/**
+ * Binary Telemetry (Compact Batches For Radio / Serial Links)
+ *
+ * - Samples go into a ring buffer through service()
+ * - Every 10 s the buffer is encoded into one binary batch:
+ *   flags byte + zigzag varint raw delta + varint time delta per sample
+ * - Stable temperatures at 500 ms take 3 bytes per sample, versus
+ *   ~20 bytes for a printed "timestamp,temperature" line
+ *
+ * Notes:
+ * - The batch is printed as hex here; send payload / length over
+ *   your radio instead
+ * - Gateway side: TMP11x_TelemetryDecoder, or the format described
+ *   in 7Semi_TMP11x_Telemetry.h
+ */
+
+#include <7Semi_TMP11x.h>
+#include <7Semi_TMP11x_RingBuffer.h>
+#include <7Semi_TMP11x_Telemetry.h>
+
+TMP11x_7Semi tmp(Wire);
+
+TMP11x_RingBuffer<32> samples;
+TMP11x_TelemetryEncoder encoder;
+
+/**
+ * Header plus 32 worst-case records.
+ */
+uint8_t payload[TMP11X_TLM_HEADER_MAX + 32 * TMP11X_TLM_RECORD_MAX];
+
+uint32_t lastSend = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  if (!tmp.begin(0x48)) {
+    Serial.println("TMP11x not found!");
+    while (1) delay(100);
+  }
+
+  tmp.configure(TMP11x_Config()
+                  .withMode(CONTINUOUS_0)
+                  .withConversionRate(CONV_500MS)
+                  .withAveraging(AVG_8));
+
+  tmp.addSampleSink(samples);
+}
+
+void loop() {
+  tmp.service();
+
+  if (millis() - lastSend < 10000 || samples.isEmpty())
+    return;
+  lastSend = millis();
+
+  TMP11x_Sample first;
+  samples.peek(0, first);
+
+  encoder.beginBatch(payload, sizeof(payload), first.timestampMs);
+  uint16_t n = encoder.addFrom(samples);
+
+  Serial.print(n);
+  Serial.print(" samples, ");
+  Serial.print(encoder.length());
+  Serial.print(" bytes: ");
+  for (uint16_t i = 0; i < encoder.length(); i++) {
+    if (payload[i] < 0x10)
+      Serial.print('0');
+    Serial.print(payload[i], HEX);
+  }
+  Serial.println();
+}
@@ -0,0 +1,77 @@
+/**
+ * Transaction Queue (Sensor Array)
+ *
+ * - Queues one-shot triggers for every sensor, later queues the reads
+ * - Results arrive in a completion callback, in queue order
+ * - On Wire the queue runs each transaction synchronously in service();
+ *   with a TMP11x_AsyncTransport (DMA / interrupt I2C) service()
+ *   returns while a transfer is in flight
+ *
+ * Possible I2C addresses (based on ADDR pin):
+ * - 0x48 : ADDR = GND
+ * - 0x49 : ADDR = VDD
+ * - 0x4A : ADDR = SDA
+ * - 0x4B : ADDR = SCL
+ */
+
+#include <7Semi_TMP11x.h>
+#include <7Semi_TMP11x_Bus.h>
+#include <7Semi_TMP11x_Transaction.h>
+
+TMP11x_Bus bus(Wire);
+TMP11x_TransactionQueue queue;
+
+uint32_t triggeredAt = 0;
+bool converting = false;
+
+/**
+ * Called for every finished temperature read.
+ */
+void onTemperature(TMP11x_7Semi &sensor, uint8_t reg, uint16_t value, TMP11x_Status result) {
+  (void)reg;
+  Serial.print("0x");
+  Serial.print(sensor.getAddress(), HEX);
+  Serial.print(": ");
+  if (result == TMP11X_OK) {
+    Serial.print(TMP11x_rawToMilliC((int16_t)value));
+    Serial.println(" mC");
+  } else {
+    Serial.print("error ");
+    Serial.println((int)result);
+  }
+}
+
+void setup() {
+  Serial.begin(115200);
+
+  if (bus.begin() == 0) {
+    Serial.println("No TMP11x found!");
+    while (1) delay(100);
+  }
+
+  bus.configureAll(TMP11x_Config()
+                     .withMode(SHUTDOWN)
+                     .withAveraging(AVG_8));
+}
+
+void loop() {
+  queue.service();
+
+  TMP11x_7Semi *s;
+
+  if (!converting && queue.pending() == 0 && millis() - triggeredAt >= 1000) {
+    for (uint8_t i = 0; bus.sensor(i, s); i++)
+      queue.enqueueOneShot(*s);
+    triggeredAt = millis();
+    converting = true;
+  }
+
+  /**
+   * AVG_8 conversion takes ~125 ms; queue the reads afterwards.
+   */
+  if (converting && queue.pending() == 0 && millis() - triggeredAt >= 140) {
+    for (uint8_t i = 0; bus.sensor(i, s); i++)
+      queue.enqueueReadTemperature(*s, onTemperature);
+    converting = false;
+  }
+}
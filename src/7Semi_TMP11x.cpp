@@ -8,13 +8,83 @@
  *   - Temperature register LSB = 0.0078125 °C (7.8125 m°C)
  * - Notes:
  *   - ESP32/ESP8266 can optionally use custom SDA/SCL pins
- *   - EEPROM writes require a short internal write time (~10 ms)
+ *   - EEPROM writes take ~7 ms; completion is polled via EEPROM_Busy
  */
 
 #include "7Semi_TMP11x.h"
+#include "7Semi_TMP11x_BusLock.h"
+#include "7Semi_TMP11x_Calibration.h"
+#include "7Semi_TMP11x_Transport.h"
+
+/* One-shot state machine states */
+#define ONE_SHOT_IDLE        0
+#define ONE_SHOT_CONVERTING  1
+#define ONE_SHOT_DONE        2
+
+/* EEPROM session states */
+#define EEPROM_IDLE          0
+#define EEPROM_WRITE         1
+#define EEPROM_PROGRAM       2
+#define EEPROM_LOCK          3
+#define EEPROM_RELOCK        4
+
+/* Pointer register state unknown */
+#define POINTER_UNKNOWN      0xFF
+
+#if defined(ESP32) || defined(ESP8266)
+#define TMP11X_ISR_ATTR IRAM_ATTR
+#else
+#define TMP11X_ISR_ATTR
+#endif
+
+TMP11x_7Semi *TMP11x_7Semi::irqOwners[TMP11X_MAX_IRQ_SENSORS];
 
 TMP11x_7Semi::TMP11x_7Semi(TwoWire &wirePort) {
     i2c = &wirePort;
+    transport = NULL;
+    address = 0x48;
+    deviceId = 0;
+    status = TMP11X_OK;
+    busSda = 0xFF;
+    busScl = 0xFF;
+    busClock = 400000;
+    resetRetryStats();
+#ifdef TMP11X_ENABLE_TIMING
+    resetTimingStats();
+#endif
+    busLock = NULL;
+    busLockTimeoutMs = 100;
+    calibration = NULL;
+    lastPointer = POINTER_UNKNOWN;
+    pointerCacheEnabled = true;
+    configCache = 0;
+    cacheEnabled = false;
+    cacheValid = false;
+    statusFlags = 0;
+    sampleAlerts = 0;
+    eepromCount = 0;
+    eepromIndex = 0;
+    eepromState = EEPROM_IDLE;
+    eepromStart = 0;
+    oneShotState = ONE_SHOT_IDLE;
+    oneShotStart = 0;
+    oneShotWait = 0;
+    irqPending = false;
+    irqTime = 0;
+    irqPin = 0xFF;
+    irqSlot = -1;
+    sampleCallback = NULL;
+    sinks = NULL;
+    sampleTime = 0;
+}
+
+/**
+ * Constructor for a custom transport.
+ */
+TMP11x_7Semi::TMP11x_7Semi(TMP11x_Transport &busTransport)
+    : TMP11x_7Semi(Wire) {
+    i2c = NULL;
+    transport = &busTransport;
 }
 
 /* ================= Initialization ================= */
@@ -25,10 +95,91 @@ TMP11x_7Semi::TMP11x_7Semi(TwoWire &wirePort) {
  * - Sets I2C address and initializes Wire
  * - Optionally configures SDA/SCL on supported platforms (ESP32/ESP8266)
  * - Sets I2C clock
- * - Verifies device ID (expects 0x0117)
+ * - Verifies device ID (TMP116 / TMP117, any revision)
  */
-bool TMP11x_7Semi::begin(uint8_t i2cAddress, uint8_t sda, uint8_t scl, uint32_t i2cClockSpeed) {
-    address = i2cAddress;
+bool TMP11x_7Semi::begin(uint8_t i2cAddress, uint8_t sda, uint8_t scl, uint32_t i2cClockSpeed, bool initializeBus) {
+    busSda = sda;
+    busScl = scl;
+    busClock = i2cClockSpeed;
+
+    if (initializeBus)
+        initBus();
+
+    return attach(i2cAddress);
+}
+
+/**
+ * Warm start from retained state.
+ *
+ * - The config cache is restored as retained; the register pointer is
+ *   not trusted (costs one pointer write on the first read)
+ */
+bool TMP11x_7Semi::quickBegin(const TMP11x_RetainedState &state, bool initializeBus) {
+    if (state.magic != TMP11X_RETAINED_MAGIC ||
+        ((state.deviceId & 0x0FFF) != MODEL_TMP116 && (state.deviceId & 0x0FFF) != MODEL_TMP117))
+        return fail(TMP11X_ERR_INVALID_ARG);
+
+    busSda = state.sda;
+    busScl = state.scl;
+    busClock = state.clock;
+
+    if (initializeBus)
+        initBus();
+
+    selectDevice(state.address);
+    deviceId = state.deviceId;
+
+    cacheEnabled = (state.flags & TMP11X_RETAINED_CACHE_ON) != 0;
+    if (cacheEnabled && (state.flags & TMP11X_RETAINED_CONFIG_VALID))
+        cacheConfig(state.config);
+
+    status = TMP11X_OK;
+    return true;
+}
+
+/**
+ * Save driver state for quickBegin().
+ */
+void TMP11x_7Semi::retainState(TMP11x_RetainedState &state) const {
+    state.magic = TMP11X_RETAINED_MAGIC;
+    state.address = address;
+    state.sda = busSda;
+    state.scl = busScl;
+    state.flags = (cacheEnabled ? TMP11X_RETAINED_CACHE_ON : 0) |
+                  (cacheEnabled && cacheValid ? TMP11X_RETAINED_CONFIG_VALID : 0);
+    state.deviceId = deviceId;
+    state.config = configCache;
+    state.clock = busClock;
+}
+
+/**
+ * Initialize and apply a profile.
+ *
+ * - Normal boots: four register reads, no writes
+ * - First boot / changed profile: differing fields persisted to EEPROM
+ */
+bool TMP11x_7Semi::begin(const TMP11x_Profile &profile,
+                         uint8_t i2cAddress,
+                         uint8_t sda,
+                         uint8_t scl,
+                         uint32_t i2cClockSpeed) {
+    if (!begin(i2cAddress, sda, scl, i2cClockSpeed))
+        return false;
+
+    uint8_t mismatches;
+    if (!verifyProfile(profile, true, mismatches))
+        return false;
+
+    return flushEEPROM();
+}
+
+/**
+ * Initialize Wire with the stored pins and clock.
+ */
+void TMP11x_7Semi::initBus() {
+    /* Custom transports are set up by their owner */
+    if (!i2c)
+        return;
 
 #if defined(ESP32) || defined(ESP8266)
     /**
@@ -37,8 +188,8 @@ bool TMP11x_7Semi::begin(uint8_t i2cAddress, uint8_t sda, uint8_t scl, uint32_t
      * - If valid pins are provided, initialize Wire on those pins
      * - Otherwise use default pins
      */
-    if (sda != 0xFF && scl != 0xFF) {
-        i2c->begin(sda, scl);
+    if (busSda != 0xFF && busScl != 0xFF) {
+        i2c->begin(busSda, busScl);
     } else {
         i2c->begin();
     }
@@ -49,12 +200,20 @@ bool TMP11x_7Semi::begin(uint8_t i2cAddress, uint8_t sda, uint8_t scl, uint32_t
     i2c->begin();
 #endif
 
-    (void)scl;
-    (void)sda;
     /**
      * Configure I2C clock speed for the bus
      */
-    i2c->setClock(i2cClockSpeed);
+    i2c->setClock(busClock);
+}
+
+/**
+ * Attach to a device on an already initialized bus.
+ *
+ * - Resets all cached state for the new address
+ * - Verifies device ID (DID 0x117 or 0x116, any revision)
+ */
+bool TMP11x_7Semi::attach(uint8_t i2cAddress) {
+    selectDevice(i2cAddress);
 
     /**
      * Confirm correct device is connected by checking DEVICE_ID
@@ -63,10 +222,167 @@ bool TMP11x_7Semi::begin(uint8_t i2cAddress, uint8_t sda, uint8_t scl, uint32_t
     if (!getDeviceID(deviceID))
         return false;
 
-    if ((deviceID == 0x0117) || (deviceID == 0x1116))
+    if (deviceModel() != MODEL_UNKNOWN)
         return true;
 
-    return false;
+    return fail(TMP11X_ERR_DEVICE_ID);
+}
+
+/**
+ * Select a device address and drop state of the previous one.
+ */
+void TMP11x_7Semi::selectDevice(uint8_t i2cAddress) {
+    address = i2cAddress;
+    deviceId = 0;
+    lastPointer = POINTER_UNKNOWN;
+    cacheValid = false;
+    statusFlags = 0;
+    sampleAlerts = 0;
+    oneShotState = ONE_SHOT_IDLE;
+}
+
+/**
+ * Get the 7-bit I2C address used by this instance.
+ */
+uint8_t TMP11x_7Semi::getAddress() const {
+    return address;
+}
+
+/* ================= Status ================= */
+
+/**
+ * Status of the most recent operation.
+ */
+TMP11x_Status TMP11x_7Semi::lastError() const {
+    return status;
+}
+
+/* ================= Retry / Recovery ================= */
+
+/**
+ * Set retry policy.
+ */
+void TMP11x_7Semi::setRetryPolicy(const TMP11x_RetryPolicy &policy) {
+    retryPolicy = policy;
+}
+
+/**
+ * Get current retry policy.
+ */
+const TMP11x_RetryPolicy &TMP11x_7Semi::getRetryPolicy() const {
+    return retryPolicy;
+}
+
+/**
+ * Get retry counters.
+ */
+const TMP11x_RetryStats &TMP11x_7Semi::getRetryStats() const {
+    return retryStats;
+}
+
+/**
+ * Clear retry counters.
+ */
+void TMP11x_7Semi::resetRetryStats() {
+    retryStats.transactions = 0;
+    retryStats.retries = 0;
+    retryStats.recovered = 0;
+    retryStats.failures = 0;
+    retryStats.busRecoveries = 0;
+}
+
+#ifdef TMP11X_ENABLE_TIMING
+/**
+ * Get register path timing counters.
+ */
+const TMP11x_TimingStats &TMP11x_7Semi::getTimingStats() const {
+    return timingStats;
+}
+
+/**
+ * Clear timing counters.
+ */
+void TMP11x_7Semi::resetTimingStats() {
+    memset(&timingStats, 0, sizeof(timingStats));
+}
+
+/**
+ * Add one call to a timing counter.
+ */
+void TMP11x_7Semi::recordTiming(TMP11x_TimingCounter &counter, uint32_t startUs, uint8_t ok) {
+    uint32_t elapsed = micros() - startUs;
+
+    counter.count++;
+    if (!ok)
+        counter.failures++;
+    counter.totalUs += elapsed;
+    if (elapsed > counter.maxUs)
+        counter.maxUs = elapsed;
+}
+#endif
+
+/**
+ * Release a stuck bus.
+ *
+ * - Lines are driven open-drain style: OUTPUT LOW or INPUT_PULLUP
+ * - A slave holding SDA low releases it after finishing its byte
+ */
+uint8_t TMP11x_7Semi::recoverBus() {
+    uint8_t sda = busSda;
+    uint8_t scl = busScl;
+
+#if defined(SDA) && defined(SCL)
+    if (sda == 0xFF || scl == 0xFF) {
+        sda = SDA;
+        scl = SCL;
+    }
+#endif
+
+    if (!i2c || sda == 0xFF || scl == 0xFF)
+        return fail(TMP11X_ERR_INVALID_ARG);
+
+    /* Other masters must stay off the bus while the pins are driven */
+    if (!lockBus())
+        return false;
+
+    retryStats.busRecoveries++;
+    lastPointer = POINTER_UNKNOWN;
+
+#if defined(ESP32) || defined(ARDUINO_ARCH_AVR)
+    /* Release pins from the I2C peripheral */
+    i2c->end();
+#endif
+
+    pinMode(sda, INPUT_PULLUP);
+    pinMode(scl, INPUT_PULLUP);
+    delayMicroseconds(5);
+
+    /* Clock out up to 9 bits until SDA is released */
+    for (uint8_t i = 0; i < 9 && digitalRead(sda) == LOW; i++) {
+        digitalWrite(scl, LOW);
+        pinMode(scl, OUTPUT);
+        delayMicroseconds(5);
+        pinMode(scl, INPUT_PULLUP);
+        delayMicroseconds(5);
+    }
+
+    /* STOP: SDA low -> high while SCL is high */
+    digitalWrite(sda, LOW);
+    pinMode(sda, OUTPUT);
+    delayMicroseconds(5);
+    pinMode(sda, INPUT_PULLUP);
+    delayMicroseconds(5);
+
+    bool released = digitalRead(sda) == HIGH;
+
+    initBus();
+    unlockBus();
+
+    if (!released)
+        return fail(TMP11X_ERR_BUS);
+
+    status = TMP11X_OK;
+    return true;
 }
 
 /* ================= Device ================= */
@@ -77,7 +393,32 @@ bool TMP11x_7Semi::begin(uint8_t i2cAddress, uint8_t sda, uint8_t scl, uint32_t
  * - Expected TMP117 ID: 0x0117
  */
 uint8_t TMP11x_7Semi::getDeviceID(uint16_t &deviceID) {
-    return readReg(REG_DEVICE_ID, deviceID);
+    if (!readReg(REG_DEVICE_ID, deviceID))
+        return false;
+
+    deviceId = deviceID;
+    return true;
+}
+
+/**
+ * Model from the cached DEVICE_ID.
+ */
+TMP11x_MODEL TMP11x_7Semi::deviceModel() const {
+    switch (deviceId & 0x0FFF) {
+    case MODEL_TMP116:
+        return MODEL_TMP116;
+    case MODEL_TMP117:
+        return MODEL_TMP117;
+    default:
+        return MODEL_UNKNOWN;
+    }
+}
+
+/**
+ * Revision from the cached DEVICE_ID.
+ */
+uint8_t TMP11x_7Semi::deviceRevision() const {
+    return (uint8_t)(deviceId >> 12);
 }
 
 /* ================= Temperature ================= */
@@ -93,6 +434,12 @@ uint8_t TMP11x_7Semi::readRawTemperature(int16_t &rawTemperature) {
     if (!readReg(REG_TEMP, raw))
         return false;
     rawTemperature = (int16_t)raw;
+
+    if (calibration)
+        rawTemperature = calibration->correct(rawTemperature);
+
+    /* Reading TEMP consumes the Data_Ready flag */
+    statusFlags &= ~TMP11X_CFG_DATA_READY;
     return true;
 }
 
@@ -122,179 +469,564 @@ uint8_t TMP11x_7Semi::readTemperatureF(float &temperatureF) {
     return true;
 }
 
-/* ================= Configuration ================= */
-
 /**
- * Read the TMP117 configuration register.
+ * Read temperature in milli-degrees Celsius.
+ *
+ * - Integer only: raw * 125 / 16
  */
-uint8_t TMP11x_7Semi::readConfig(uint16_t &config) {
-    return readReg(REG_CONFIG, config);
+uint8_t TMP11x_7Semi::readTemperatureMilliC(int32_t &temperatureMilliC) {
+    int16_t raw;
+    if (!readRawTemperature(raw))
+        return false;
+    temperatureMilliC = TMP11x_rawToMilliC(raw);
+    return true;
 }
 
 /**
- * Write the TMP117 configuration register.
+ * Read temperature in centi-degrees Celsius.
+ *
+ * - Integer only: raw * 25 / 32
  */
-uint8_t TMP11x_7Semi::writeConfig(uint16_t config) {
-    return writeReg(REG_CONFIG, config);
+uint8_t TMP11x_7Semi::readTemperatureCentiC(int16_t &temperatureCentiC) {
+    int16_t raw;
+    if (!readRawTemperature(raw))
+        return false;
+    temperatureCentiC = TMP11x_rawToCentiC(raw);
+    return true;
 }
 
 /**
- * Soft reset the device.
- *
- * - Writes the reset bit in CONFIG register
+ * Read temperature as Q8.7 fixed point.
  */
-uint8_t TMP11x_7Semi::reset() {
-    return writeConfig(0x8000);  // Soft reset
+uint8_t TMP11x_7Semi::readTemperatureQ8_7(TMP11x_Q8_7 &temperature) {
+    return readRawTemperature(temperature.raw);
 }
 
-/* ================= Conversion Rate ================= */
+/* ================= Data Ready ================= */
 
 /**
- * Set conversion rate (CONFIG[9:7]).
+ * Check CONFIG Data_Ready flag.
  *
- * - Uses 3-bit field (0..7)
- * - Exact mapping depends on TMP117 datasheet table
+ * - Uses the collected flag when available to skip the CONFIG read
  */
-uint8_t TMP11x_7Semi::setConversionRate(TMP11x_CONV conversionRate) {
-    uint16_t cfg;
-    if (!readConfig(cfg))
-        return false;
+uint8_t TMP11x_7Semi::isDataReady(bool &ready) {
+    if (!(statusFlags & TMP11X_CFG_DATA_READY)) {
+        uint16_t cfg;
+        if (!readConfig(cfg))
+            return false;
+    }
 
-    cfg &= ~(0x07 << 7);
-    cfg |= ((conversionRate & 0x07) << 7);
-    return writeConfig(cfg);
+    ready = (statusFlags & TMP11X_CFG_DATA_READY) != 0;
+    status = TMP11X_OK;
+    return true;
 }
 
 /**
- * Get conversion rate (CONFIG[9:7]).
+ * Read raw temperature only if a new result is available.
  */
-uint8_t TMP11x_7Semi::getConversionRate(uint8_t &conversionRate) {
-    uint16_t cfg;
-    if (!readConfig(cfg))
+uint8_t TMP11x_7Semi::readRawTemperatureIfReady(int16_t &rawTemperature) {
+    bool ready;
+    if (!isDataReady(ready))
+        return false;
+    if (!ready)
+        return fail(TMP11X_ERR_NOT_READY);
+    if (!readRawTemperature(rawTemperature))
         return false;
 
-    conversionRate = (cfg >> 7) & 0x07;
+    deliverSample(rawTemperature, millis());
     return true;
 }
 
-/* ================= Averaging ================= */
-
 /**
- * Set averaging (CONFIG[6:5]).
- *
- * - Uses 2-bit field (0..3)
- * - Exact sample count depends on TMP117 datasheet table
+ * Read temperature in Celsius only if a new result is available.
  */
-uint8_t TMP11x_7Semi::setAveraging(TMP11x_AVG avg) {
-    uint16_t cfg;
-    if (!readConfig(cfg))
+uint8_t TMP11x_7Semi::readTemperatureIfReady(float &temperatureC) {
+    int16_t raw;
+    if (!readRawTemperatureIfReady(raw))
         return false;
-
-    cfg &= ~(0x03 << 5);
-    cfg |= ((avg & 0x03) << 5);
-    return writeConfig(cfg);
+    temperatureC = rawToCelsius(raw);
+    return true;
 }
 
+/* ================= Status Flags ================= */
+
 /**
- * Get averaging (CONFIG[6:5]).
+ * Read CONFIG and return collected status flags.
+ *
+ * - EEPROM_Busy reflects the current state only
  */
-uint8_t TMP11x_7Semi::getAveraging(uint8_t &avg) {
+uint8_t TMP11x_7Semi::readStatusFlags(uint16_t &flags) {
     uint16_t cfg;
     if (!readConfig(cfg))
         return false;
 
-    avg = (cfg >> 5) & 0x03;
+    flags = statusFlags | (cfg & TMP11X_CFG_EEPROM_BUSY);
+    statusFlags &= ~(TMP11X_CFG_HIGH_ALERT | TMP11X_CFG_LOW_ALERT);
+    sampleAlerts = 0;
     return true;
 }
 
-/* ================= Power / Mode ================= */
+/**
+ * Get collected status flags without bus traffic.
+ */
+uint16_t TMP11x_7Semi::pendingStatusFlags() const {
+    return statusFlags;
+}
+
+/* ================= Configuration ================= */
 
 /**
- * Set device operating mode (CONFIG[11:10]).
- *
- * - Uses 2-bit field (0..3)
- * - Exact meaning depends on TMP11x datasheet table (continuous / shutdown / one-shot)
+ * Read the TMP117 configuration register.
  */
-uint8_t TMP11x_7Semi::setMode(TMP11x_MODE  mode) {
-    uint16_t cfg;
-     /* Read current configuration */
-    if (!readConfig(cfg))
+uint8_t TMP11x_7Semi::readConfig(uint16_t &config) {
+    if (!readReg(REG_CONFIG, config))
         return false;
 
-    /* Clear mode bits CONFIG[11:10] */
-    cfg &= ~(0x03 << 10);
-
-    /* Set new mode */
-    cfg |= ((uint16_t)mode & 0x03) << 10;
+    /* Device clears these on read; keep them for the caller */
+    statusFlags |= config & (TMP11X_CFG_HIGH_ALERT | TMP11X_CFG_LOW_ALERT | TMP11X_CFG_DATA_READY);
+    sampleAlerts |= config & (TMP11X_CFG_HIGH_ALERT | TMP11X_CFG_LOW_ALERT);
 
-    /* Write configuration */
-    return writeConfig(cfg);
+    if (cacheEnabled)
+        cacheConfig(config);
+    return true;
 }
 
 /**
- * Get device operating mode (CONFIG[11:10]).
+ * Write the TMP117 configuration register.
  */
-uint8_t TMP11x_7Semi::getMode(uint8_t &mode) {
-    uint16_t cfg;
-
-    /* Read configuration */
-    if (!readConfig(cfg))
+uint8_t TMP11x_7Semi::writeConfig(uint16_t config) {
+    if (!writeReg(REG_CONFIG, config)) {
+        cacheValid = false;
         return false;
+    }
 
-    /* Extract mode bits */
-    mode = (uint8_t)((cfg >> 10) & 0x03);
+    if (config & TMP11X_CFG_SOFT_RESET)
+        cacheValid = false;
+    else if (cacheEnabled)
+        cacheConfig(config);
     return true;
 }
 
-/* ================= Alert Limits ================= */
-
 /**
- * Set high temperature limit threshold.
+ * Soft reset the device.
  *
- * - Value is stored in TMP117 format (same LSB scaling as temperature)
+ * - Writes the Soft_Reset bit (CONFIG[1])
+ * - Device reloads CONFIG from EEPROM, so the cache is invalidated
  */
-uint8_t TMP11x_7Semi::setHighLimit(float tempC) {
-    return writeReg(REG_T_HIGH, celsiusToRaw(tempC));
+uint8_t TMP11x_7Semi::reset() {
+    cacheValid = false;
+    uint8_t ok = writeReg(REG_CONFIG, TMP11X_CFG_SOFT_RESET);
+    lastPointer = POINTER_UNKNOWN;
+    return ok;
 }
 
 /**
- * Set low temperature limit threshold.
+ * Apply a complete configuration with a single CONFIG write.
  */
-uint8_t TMP11x_7Semi::setLowLimit(float tempC) {
-    return writeReg(REG_T_LOW, celsiusToRaw(tempC));
+uint8_t TMP11x_7Semi::configure(const TMP11x_Config &cfg) {
+    return writeConfig(cfg.word());
 }
 
+/* ================= Config Cache ================= */
+
 /**
- * Read high temperature limit threshold.
+ * Enable or disable the CONFIG shadow cache.
+ *
+ * - Enabling reads CONFIG once to seed the cache
  */
-uint8_t TMP11x_7Semi::getHighLimit(float &tempC) {
-    uint16_t raw;
-    if (!readReg(REG_T_HIGH, raw))
-        return false;
-    tempC = rawToCelsius((int16_t)raw);
-    return true;
+uint8_t TMP11x_7Semi::enableConfigCache(bool enable) {
+    cacheEnabled = enable;
+    cacheValid = false;
+
+    if (!enable)
+        return true;
+
+    return syncConfig();
 }
 
 /**
- * Read low temperature limit threshold.
+ * Check whether the CONFIG shadow cache is enabled.
  */
-uint8_t TMP11x_7Semi::getLowLimit(float &tempC) {
-    uint16_t raw;
-    if (!readReg(REG_T_LOW, raw))
-        return false;
-    tempC = rawToCelsius((int16_t)raw);
-    return true;
+bool TMP11x_7Semi::isConfigCacheEnabled() const {
+    return cacheEnabled;
 }
 
-/* ================= Offset ================= */
+/**
+ * Reload the CONFIG shadow cache from the device.
+ */
+uint8_t TMP11x_7Semi::syncConfig() {
+    uint16_t cfg;
+    cacheValid = false;
+    return readConfig(cfg);
+}
 
 /**
- * Set temperature offset (TEMP_OFFSET register).
+ * Get current CONFIG value.
  *
- * - Used for simple calibration adjustment
+ * - No bus traffic when the cache is valid
  */
-uint8_t TMP11x_7Semi::setOffset(float offsetC) {
-    return writeReg(REG_TEMP_OFFSET, celsiusToRaw(offsetC));
+uint8_t TMP11x_7Semi::loadConfig(uint16_t &config) {
+    if (cacheEnabled && cacheValid) {
+#ifdef TMP11X_ENABLE_TIMING
+        timingStats.cacheHits++;
+#endif
+        config = configCache;
+        status = TMP11X_OK;
+        return true;
+    }
+#ifdef TMP11X_ENABLE_TIMING
+    timingStats.cacheMisses++;
+#endif
+    return readConfig(config);
+}
+
+/**
+ * Replace CONFIG bits selected by mask.
+ *
+ * - Status flags and soft reset bit are never written back
+ */
+uint8_t TMP11x_7Semi::updateConfig(uint16_t mask, uint16_t bits) {
+    uint16_t cfg;
+    if (!loadConfig(cfg))
+        return false;
+
+    cfg &= TMP11X_CFG_WRITABLE_MASK & ~mask;
+    cfg |= bits & mask;
+    return writeConfig(cfg);
+}
+
+/**
+ * Store a CONFIG value in the shadow cache.
+ */
+void TMP11x_7Semi::cacheConfig(uint16_t config) {
+    configCache = normalizeConfig(config);
+    cacheValid = true;
+}
+
+/**
+ * Writable CONFIG bits as the device reads them back.
+ *
+ * - MOD = 2 reads back as continuous (0)
+ * - MOD = 3 (one-shot) returns to shutdown (1) after the conversion
+ */
+uint16_t TMP11x_7Semi::normalizeConfig(uint16_t config) {
+    uint16_t mode = (config >> 10) & 0x03;
+
+    if (mode == CONTINUOUS_2)
+        mode = CONTINUOUS_0;
+    else if (mode == ONE_SHOT)
+        mode = SHUTDOWN;
+
+    return (config & TMP11X_CFG_WRITABLE_MASK & ~(0x03 << 10)) | (mode << 10);
+}
+
+/* ================= Conversion Rate ================= */
+
+/**
+ * Set conversion rate (CONFIG[9:7]).
+ *
+ * - Uses 3-bit field (0..7)
+ * - Exact mapping depends on TMP117 datasheet table
+ */
+uint8_t TMP11x_7Semi::setConversionRate(TMP11x_CONV conversionRate) {
+    return updateConfig(0x07 << 7, (conversionRate & 0x07) << 7);
+}
+
+/**
+ * Get conversion rate (CONFIG[9:7]).
+ */
+uint8_t TMP11x_7Semi::getConversionRate(uint8_t &conversionRate) {
+    uint16_t cfg;
+    if (!loadConfig(cfg))
+        return false;
+
+    conversionRate = (cfg >> 7) & 0x07;
+    return true;
+}
+
+/* ================= Conversion Timing ================= */
+
+/**
+ * Cycle time of the current configuration.
+ */
+uint8_t TMP11x_7Semi::getConversionTimeMs(uint16_t &timeMs) {
+    uint16_t cfg;
+    if (!loadConfig(cfg))
+        return false;
+
+    timeMs = conversionTimeMs((TMP11x_CONV)((cfg >> 7) & 0x07), (TMP11x_AVG)((cfg >> 5) & 0x03));
+    return true;
+}
+
+/**
+ * Active (one-shot) time of the current configuration.
+ */
+uint8_t TMP11x_7Semi::getActiveTimeMs(uint16_t &timeMs) {
+    uint16_t cfg;
+    if (!loadConfig(cfg))
+        return false;
+
+    timeMs = activeTimeMs((TMP11x_AVG)((cfg >> 5) & 0x03));
+    return true;
+}
+
+/* ================= Averaging ================= */
+
+/**
+ * Set averaging (CONFIG[6:5]).
+ *
+ * - Uses 2-bit field (0..3)
+ * - Exact sample count depends on TMP117 datasheet table
+ */
+uint8_t TMP11x_7Semi::setAveraging(TMP11x_AVG avg) {
+    return updateConfig(0x03 << 5, (avg & 0x03) << 5);
+}
+
+/**
+ * Get averaging (CONFIG[6:5]).
+ */
+uint8_t TMP11x_7Semi::getAveraging(uint8_t &avg) {
+    uint16_t cfg;
+    if (!loadConfig(cfg))
+        return false;
+
+    avg = (cfg >> 5) & 0x03;
+    return true;
+}
+
+/**
+ * Set conversion rate (CONFIG[9:7]) and averaging (CONFIG[6:5]) together.
+ */
+uint8_t TMP11x_7Semi::setConversionTiming(TMP11x_CONV conversionRate, TMP11x_AVG avg) {
+    return updateConfig((0x07 << 7) | (0x03 << 5),
+                        ((conversionRate & 0x07) << 7) | ((avg & 0x03) << 5));
+}
+
+/* ================= Power / Mode ================= */
+
+/**
+ * Set device operating mode (CONFIG[11:10]).
+ *
+ * - Uses 2-bit field (0..3)
+ * - Exact meaning depends on TMP11x datasheet table (continuous / shutdown / one-shot)
+ */
+uint8_t TMP11x_7Semi::setMode(TMP11x_MODE  mode) {
+    /* Replace mode bits CONFIG[11:10] */
+    return updateConfig(0x03 << 10, ((uint16_t)mode & 0x03) << 10);
+}
+
+/**
+ * Get device operating mode (CONFIG[11:10]).
+ */
+uint8_t TMP11x_7Semi::getMode(uint8_t &mode) {
+    uint16_t cfg;
+
+    /* Read configuration */
+    if (!loadConfig(cfg))
+        return false;
+
+    /* Extract mode bits */
+    mode = (uint8_t)((cfg >> 10) & 0x03);
+    return true;
+}
+
+/* ================= One-Shot (Non-Blocking) ================= */
+
+/**
+ * Start a one-shot conversion.
+ *
+ * - Drops any stale Data_Ready so poll() only sees this conversion
+ * - Wait time is taken from the current AVG setting
+ */
+uint8_t TMP11x_7Semi::startOneShot() {
+    uint16_t word;
+    if (!prepareOneShot(word))
+        return false;
+    return triggerOneShot(word);
+}
+
+/**
+ * Build the one-shot CONFIG word from the current configuration.
+ */
+uint8_t TMP11x_7Semi::prepareOneShot(uint16_t &word) {
+    uint16_t cfg;
+    if (!loadConfig(cfg))
+        return false;
+
+    oneShotWait = activeTimeMs((TMP11x_AVG)((cfg >> 5) & 0x03));
+
+    cfg &= TMP11X_CFG_WRITABLE_MASK & ~(0x03 << 10);
+    word = cfg | ((uint16_t)ONE_SHOT << 10);
+    return true;
+}
+
+/**
+ * Write a prepared one-shot word.
+ */
+uint8_t TMP11x_7Semi::triggerOneShot(uint16_t word) {
+    statusFlags &= ~TMP11X_CFG_DATA_READY;
+
+    if (!writeConfig(word)) {
+        oneShotState = ONE_SHOT_IDLE;
+        return false;
+    }
+
+    oneShotStart = millis();
+    oneShotState = ONE_SHOT_CONVERTING;
+    return true;
+}
+
+/**
+ * Advance the one-shot state machine.
+ *
+ * - Deadline adds 1/8 of the expected time for oscillator tolerance
+ */
+bool TMP11x_7Semi::poll() {
+    if (oneShotState != ONE_SHOT_CONVERTING)
+        return oneShotState == ONE_SHOT_DONE;
+
+    uint32_t elapsed = millis() - oneShotStart;
+    if (elapsed < oneShotWait)
+        return false;
+
+    bool ready = false;
+    if (!isDataReady(ready))
+        ready = false;
+
+    if (ready || elapsed >= (uint32_t)oneShotWait + (oneShotWait >> 3) + 2)
+        oneShotState = ONE_SHOT_DONE;
+
+    return oneShotState == ONE_SHOT_DONE;
+}
+
+/**
+ * Check whether the started one-shot has completed.
+ */
+bool TMP11x_7Semi::isConversionDone() const {
+    return oneShotState == ONE_SHOT_DONE;
+}
+
+/**
+ * Fetch the one-shot result (raw code).
+ */
+uint8_t TMP11x_7Semi::fetchRaw(int16_t &rawTemperature) {
+    if (oneShotState != ONE_SHOT_DONE)
+        return fail(oneShotState == ONE_SHOT_IDLE ? TMP11X_ERR_INVALID_ARG : TMP11X_ERR_NOT_READY);
+
+    if (!readRawTemperature(rawTemperature))
+        return false;
+
+    oneShotState = ONE_SHOT_IDLE;
+    deliverSample(rawTemperature, millis());
+    return true;
+}
+
+/**
+ * Fetch the one-shot result in Celsius.
+ */
+uint8_t TMP11x_7Semi::fetch(float &temperatureC) {
+    int16_t raw;
+    if (!fetchRaw(raw))
+        return false;
+    temperatureC = rawToCelsius(raw);
+    return true;
+}
+
+/* ================= Register Pointer Cache ================= */
+
+/**
+ * Enable or disable register pointer caching.
+ */
+void TMP11x_7Semi::enablePointerCache(bool enable) {
+    pointerCacheEnabled = enable;
+    lastPointer = POINTER_UNKNOWN;
+}
+
+/* ================= Alert Limits ================= */
+
+/**
+ * Set high temperature limit threshold.
+ *
+ * - Value is stored in TMP117 format (same LSB scaling as temperature)
+ */
+uint8_t TMP11x_7Semi::setHighLimit(float tempC) {
+    return writeReg(REG_T_HIGH, celsiusToRaw(tempC));
+}
+
+/**
+ * Set low temperature limit threshold.
+ */
+uint8_t TMP11x_7Semi::setLowLimit(float tempC) {
+    return writeReg(REG_T_LOW, celsiusToRaw(tempC));
+}
+
+/**
+ * Read high temperature limit threshold.
+ */
+uint8_t TMP11x_7Semi::getHighLimit(float &tempC) {
+    uint16_t raw;
+    if (!readReg(REG_T_HIGH, raw))
+        return false;
+    tempC = rawToCelsius((int16_t)raw);
+    return true;
+}
+
+/**
+ * Read low temperature limit threshold.
+ */
+uint8_t TMP11x_7Semi::getLowLimit(float &tempC) {
+    uint16_t raw;
+    if (!readReg(REG_T_LOW, raw))
+        return false;
+    tempC = rawToCelsius((int16_t)raw);
+    return true;
+}
+
+/**
+ * Set high limit in milli-degrees Celsius.
+ */
+uint8_t TMP11x_7Semi::setHighLimitMilliC(int32_t milliC) {
+    return writeReg(REG_T_HIGH, TMP11x_milliCToRaw(milliC));
+}
+
+/**
+ * Set low limit in milli-degrees Celsius.
+ */
+uint8_t TMP11x_7Semi::setLowLimitMilliC(int32_t milliC) {
+    return writeReg(REG_T_LOW, TMP11x_milliCToRaw(milliC));
+}
+
+/**
+ * Read high limit in milli-degrees Celsius.
+ */
+uint8_t TMP11x_7Semi::getHighLimitMilliC(int32_t &milliC) {
+    uint16_t raw;
+    if (!readReg(REG_T_HIGH, raw))
+        return false;
+    milliC = TMP11x_rawToMilliC((int16_t)raw);
+    return true;
+}
+
+/**
+ * Read low limit in milli-degrees Celsius.
+ */
+uint8_t TMP11x_7Semi::getLowLimitMilliC(int32_t &milliC) {
+    uint16_t raw;
+    if (!readReg(REG_T_LOW, raw))
+        return false;
+    milliC = TMP11x_rawToMilliC((int16_t)raw);
+    return true;
+}
+
+/* ================= Offset ================= */
+
+/**
+ * Set temperature offset (TEMP_OFFSET register).
+ *
+ * - Used for simple calibration adjustment
+ */
+uint8_t TMP11x_7Semi::setOffset(float offsetC) {
+    return writeReg(REG_TEMP_OFFSET, celsiusToRaw(offsetC));
 }
 
 /**
@@ -308,91 +1040,290 @@ uint8_t TMP11x_7Semi::getOffset(float &offsetC) {
     return true;
 }
 
-/* ================= Alert Polarity ================= */
-
 /**
- * Set ALERT pin polarity (CONFIG[3]).
+ * Set temperature offset in milli-degrees Celsius.
+ */
+uint8_t TMP11x_7Semi::setOffsetMilliC(int32_t milliC) {
+    return writeReg(REG_TEMP_OFFSET, TMP11x_milliCToRaw(milliC));
+}
+
+/**
+ * Read temperature offset in milli-degrees Celsius.
+ */
+uint8_t TMP11x_7Semi::getOffsetMilliC(int32_t &milliC) {
+    uint16_t raw;
+    if (!readReg(REG_TEMP_OFFSET, raw))
+        return false;
+    milliC = TMP11x_rawToMilliC((int16_t)raw);
+    return true;
+}
+
+/* ================= Alert Polarity ================= */
+
+/**
+ * Set ALERT pin polarity (CONFIG[3]).
+ *
+ * - 0 = Active Low
+ * - 1 = Active High
+ */
+uint8_t TMP11x_7Semi::setAlertPolarity(TMP11x_ALERT_POLARITY active_high) {
+    /**
+     * Set or clear polarity bit
+     */
+    return updateConfig(1 << 3, active_high ? (1 << 3) : 0);
+}
+
+/**
+ * Get ALERT pin polarity (CONFIG[3]).
+ *
+ * - 0 = Active Low
+ * - 1 = Active High
+ */
+uint8_t TMP11x_7Semi::getAlertPolarity(uint8_t &active_high) {
+    uint16_t config;
+
+    /**
+     * Read configuration register
+     */
+    if (!loadConfig(config))
+        return false;
+
+    /**
+     * Extract polarity bit
+     */
+    active_high = (config >> 3) & 0x01;
+    return true;
+}
+
+/* ================= Therm / Alert Mode ================= */
+
+/**
+ * Set alert behavior mode (CONFIG[4] TM bit).
+ *
+ * - 0 = Alert mode
+ * - 1 = Therm mode
+ */
+uint8_t TMP11x_7Semi::setThermAlertMode(TMP11x_THERM_ALERT mode) {
+    return updateConfig(1 << 4, (mode & 0x01) << 4);
+}
+
+/**
+ * Get alert behavior mode (CONFIG[4] TM bit).
+ *
+ * - 0 = Alert mode
+ * - 1 = Therm mode
+ */
+uint8_t TMP11x_7Semi::getThermAlertMode(uint8_t &mode) {
+    uint16_t cfg;
+    if (!loadConfig(cfg))
+        return false;
+
+    mode = (cfg >> 4) & 0x01;
+    return true;
+}
+
+/* ================= ALERT Pin Function ================= */
+
+/**
+ * Select ALERT pin function (CONFIG[2] DR/Alert bit).
+ *
+ * - 0 = Alert flags
+ * - 1 = Data_Ready
+ */
+uint8_t TMP11x_7Semi::setAlertPinFunction(TMP11x_ALERT_PIN function) {
+    return updateConfig(1 << 2, (function & 0x01) << 2);
+}
+
+/**
+ * Get ALERT pin function (CONFIG[2] DR/Alert bit).
+ */
+uint8_t TMP11x_7Semi::getAlertPinFunction(uint8_t &function) {
+    uint16_t cfg;
+    if (!loadConfig(cfg))
+        return false;
+
+    function = (cfg >> 2) & 0x01;
+    return true;
+}
+
+/* ================= Data Ready Interrupt ================= */
+
+/**
+ * ISR trampoline.
+ *
+ * - Only timestamps and flags the owner instance
+ */
+template <uint8_t SLOT>
+void TMP11X_ISR_ATTR TMP11x_7Semi::isrSlot() {
+    TMP11x_7Semi *owner = irqOwners[SLOT];
+    if (owner) {
+        owner->irqTime = millis();
+        owner->irqPending = true;
+    }
+}
+
+/**
+ * Attach an ALERT pin interrupt using a free owner slot.
+ */
+uint8_t TMP11x_7Semi::attachAlertIrq(uint8_t pin, int edge) {
+    static void (*const trampolines[])() = {
+        &TMP11x_7Semi::isrSlot<0>,
+#if TMP11X_MAX_IRQ_SENSORS > 1
+        &TMP11x_7Semi::isrSlot<1>,
+#endif
+#if TMP11X_MAX_IRQ_SENSORS > 2
+        &TMP11x_7Semi::isrSlot<2>,
+#endif
+#if TMP11X_MAX_IRQ_SENSORS > 3
+        &TMP11x_7Semi::isrSlot<3>,
+#endif
+    };
+
+    if (digitalPinToInterrupt(pin) == NOT_AN_INTERRUPT)
+        return fail(TMP11X_ERR_INVALID_ARG);
+
+    if (irqSlot < 0) {
+        for (uint8_t i = 0; i < sizeof(trampolines) / sizeof(trampolines[0]); i++) {
+            if (irqOwners[i] == NULL) {
+                irqSlot = i;
+                break;
+            }
+        }
+        if (irqSlot < 0)
+            return fail(TMP11X_ERR_INVALID_ARG);
+    } else {
+        detachInterrupt(digitalPinToInterrupt(irqPin));
+    }
+
+    irqOwners[irqSlot] = this;
+    irqPin = pin;
+    irqPending = false;
+
+    pinMode(pin, INPUT_PULLUP);
+    attachInterrupt(digitalPinToInterrupt(pin), trampolines[irqSlot], edge);
+    return true;
+}
+
+/**
+ * Route Data_Ready to ALERT and attach the MCU interrupt.
  *
- * - 0 = Active Low
- * - 1 = Active High
+ * - Reads TEMP once so a stale Data_Ready releases the pin
  */
-uint8_t TMP11x_7Semi::setAlertPolarity(TMP11x_ALERT_POLARITY active_high) {
-    uint16_t config;
+uint8_t TMP11x_7Semi::attachDataReadyInterrupt(uint8_t pin, TMP11x_SampleCallback callback) {
+    uint8_t polarity;
+    int16_t raw;
 
-    /**
-     * Read current configuration
-     */
-    if (!readConfig(config))
+    if (!setAlertPinFunction(ALERT_PIN_DATA_READY))
         return false;
 
-    /**
-     * Set or clear polarity bit
-     */
-    if (active_high)
-        config |= (1 << 3);
-    else
-        config &= ~(1 << 3);
+    if (!getAlertPolarity(polarity))
+        return false;
 
-    /**
-     * Write updated configuration
-     */
-    return writeConfig(config);
+    sampleCallback = callback;
+    if (!attachAlertIrq(pin, polarity ? RISING : FALLING))
+        return false;
+
+    return readRawTemperature(raw);
 }
 
 /**
- * Get ALERT pin polarity (CONFIG[3]).
+ * Detach the ALERT pin interrupt.
+ */
+void TMP11x_7Semi::detachDataReadyInterrupt() {
+    if (irqSlot < 0)
+        return;
+
+    detachInterrupt(digitalPinToInterrupt(irqPin));
+    irqOwners[irqSlot] = NULL;
+    irqSlot = -1;
+    irqPin = 0xFF;
+    irqPending = false;
+}
+
+/**
+ * Service sample acquisition.
  *
- * - 0 = Active Low
- * - 1 = Active High
+ * - Interrupt mode: reading TEMP clears Data_Ready and releases the ALERT pin
+ * - Polling mode: one CONFIG read per call while no sample is pending
  */
-uint8_t TMP11x_7Semi::getAlertPolarity(uint8_t &active_high) {
-    uint16_t config;
+uint8_t TMP11x_7Semi::service() {
+    int16_t raw;
 
-    /**
-     * Read configuration register
-     */
-    if (!readConfig(config))
-        return false;
+    if (irqSlot >= 0) {
+        if (!irqPending)
+            return fail(TMP11X_ERR_NOT_READY);
 
-    /**
-     * Extract polarity bit
-     */
-    active_high = (config >> 3) & 0x01;
+        noInterrupts();
+        uint32_t timestamp = irqTime;
+        irqPending = false;
+        interrupts();
+
+        if (!readRawTemperature(raw))
+            return false;
+
+        deliverSample(raw, timestamp);
+    } else {
+        if (!readRawTemperatureIfReady(raw))
+            return false;
+    }
+
+    if (sampleCallback)
+        sampleCallback(raw, sampleTime);
     return true;
 }
 
-/* ================= Therm / Alert Mode ================= */
+/* ================= Sample Sinks ================= */
 
 /**
- * Set alert behavior mode (CONFIG[4] TM bit).
- *
- * - 0 = Alert mode
- * - 1 = Therm mode
+ * Attach a sample sink at the end of the chain.
  */
-uint8_t TMP11x_7Semi::setThermAlertMode(TMP11x_THERM_ALERT mode) {
-    uint16_t cfg;
-    if (!readConfig(cfg))
-        return false;
+void TMP11x_7Semi::addSampleSink(TMP11x_SampleSink &sink) {
+    TMP11x_SampleSink **link = &sinks;
+    while (*link) {
+        if (*link == &sink)
+            return;
+        link = &(*link)->nextSink;
+    }
 
-    cfg &= ~(1 << 4);
-    cfg |= ((mode & 0x01) << 4);
+    sink.nextSink = NULL;
+    *link = &sink;
+}
 
-    return writeConfig(cfg);
+/**
+ * Detach a sample sink.
+ */
+void TMP11x_7Semi::removeSampleSink(TMP11x_SampleSink &sink) {
+    TMP11x_SampleSink **link = &sinks;
+    while (*link) {
+        if (*link == &sink) {
+            *link = sink.nextSink;
+            sink.nextSink = NULL;
+            return;
+        }
+        link = &(*link)->nextSink;
+    }
 }
 
 /**
- * Get alert behavior mode (CONFIG[4] TM bit).
+ * millis() timestamp of the last delivered sample.
+ */
+uint32_t TMP11x_7Semi::lastSampleTime() const {
+    return sampleTime;
+}
+
+/**
+ * Pass a fresh sample to all sinks.
  *
- * - 0 = Alert mode
- * - 1 = Therm mode
+ * - Forwards the alert bits seen since the previous sample, then drops
+ *   them; the latched statusFlags are left to readStatusFlags()
  */
-uint8_t TMP11x_7Semi::getThermAlertMode(uint8_t &mode) {
-    uint16_t cfg;
-    if (!readConfig(cfg))
-        return false;
+void TMP11x_7Semi::deliverSample(int16_t raw, uint32_t timestampMs) {
+    uint16_t flags = TMP11X_CFG_DATA_READY | sampleAlerts;
+    sampleAlerts = 0;
 
-    mode = (cfg >> 4) & 0x01;
-    return true;
+    sampleTime = timestampMs;
+    for (TMP11x_SampleSink *sink = sinks; sink; sink = sink->nextSink)
+        sink->onSample(raw, timestampMs, flags);
 }
 
 /* ================= EEPROM Lock / Unlock ================= */
@@ -404,14 +1335,10 @@ uint8_t TMP11x_7Semi::unlockEEPROM() {
     uint16_t ul;
 
     /* Set unlock bit (BIT15 = 1) */
-    ul = 0x8000;
+    ul = TMP11X_EEPROM_UL_UNLOCK;
 
     /* Write back */
-    if (!writeReg(REG_EEPROM_UL, ul))
-        return false;
-
-    delay(2);  // Small settle delay
-    return true;
+    return writeReg(REG_EEPROM_UL, ul);
 }
 
 /**
@@ -423,11 +1350,22 @@ uint8_t TMP11x_7Semi::lockEEPROM() {
     /* Clear unlock bit (BIT15 = 0) */
     ul = 0x0000;
 
-    if (!writeReg(REG_EEPROM_UL, ul))
-        return false;
+    return writeReg(REG_EEPROM_UL, ul);
+}
 
-    delay(2);
-    return true;
+/**
+ * Drop the EEPROM session after an error.
+ *
+ * - If locking fails too, EEPROM_RELOCK retries it on the next service
+ */
+uint8_t TMP11x_7Semi::abortEEPROM() {
+    TMP11x_Status error = status;
+
+    eepromCount = 0;
+    eepromIndex = 0;
+    eepromState = lockEEPROM() ? EEPROM_IDLE : EEPROM_RELOCK;
+
+    return fail(error);
 }
 
 /* ================= EEPROM ================= */
@@ -440,7 +1378,7 @@ uint8_t TMP11x_7Semi::lockEEPROM() {
 uint8_t TMP11x_7Semi::readEEPROM(uint8_t reg, uint16_t &value) {
 
     if (reg != REG_EEPROM1 && reg != REG_EEPROM2 && reg != REG_EEPROM3)
-        return false;
+        return fail(TMP11X_ERR_INVALID_ARG);
 
     return readReg(reg, value);
 }
@@ -449,63 +1387,580 @@ uint8_t TMP11x_7Semi::readEEPROM(uint8_t reg, uint16_t &value) {
  * Write EEPROM register value.
  *
  * - TO EEPROM1/EEPROM2/EEPROM3
- * - Device requires an internal write time after write
+ * - Returns once the program cycle completes and EEPROM is locked again
  */
 uint8_t TMP11x_7Semi::writeEEPROM(uint8_t reg, uint16_t value) {
 
     if (reg != REG_EEPROM1 && reg != REG_EEPROM2 && reg != REG_EEPROM3)
+        return fail(TMP11X_ERR_INVALID_ARG);
+
+    if (!queueEEPROMWrite(reg, value))
         return false;
 
-    /* Unlock EEPROM */
-    if (!unlockEEPROM())
+    return flushEEPROM();
+}
+
+/**
+ * Queue one word for EEPROM programming.
+ */
+uint8_t TMP11x_7Semi::queueEEPROMWrite(uint8_t reg, uint16_t value) {
+    switch (reg) {
+    case REG_CONFIG:
+        /* Flags and soft reset are not stored */
+        value &= TMP11X_CFG_WRITABLE_MASK;
+        break;
+    case REG_T_HIGH:
+    case REG_T_LOW:
+    case REG_TEMP_OFFSET:
+    case REG_EEPROM1:
+    case REG_EEPROM2:
+    case REG_EEPROM3:
+        break;
+    default:
+        return fail(TMP11X_ERR_INVALID_ARG);
+    }
+
+    /* Replace a pending (not yet written) entry for the same register */
+    uint8_t first = eepromIndex + (eepromState == EEPROM_PROGRAM ? 1 : 0);
+    for (uint8_t i = first; i < eepromCount; i++) {
+        if (eepromRegs[i] == reg) {
+            eepromValues[i] = value;
+            status = TMP11X_OK;
+            return true;
+        }
+    }
+
+    if (eepromCount >= TMP11X_EEPROM_QUEUE_SIZE)
+        return fail(TMP11X_ERR_BUSY);
+
+    eepromRegs[eepromCount] = reg;
+    eepromValues[eepromCount] = value;
+    eepromCount++;
+
+    status = TMP11X_OK;
+    return true;
+}
+
+/**
+ * Advance the EEPROM session.
+ *
+ * - Only EEPROM_PROGRAM waits (returns early while EEPROM_Busy is set)
+ * - Words queued while locking are written before the lock
+ */
+uint8_t TMP11x_7Semi::serviceEEPROM() {
+    for (;;) {
+        switch (eepromState) {
+        case EEPROM_IDLE:
+            if (eepromIndex >= eepromCount) {
+                status = TMP11X_OK;
+                return true;
+            }
+
+            if (!unlockEEPROM())
+                return abortEEPROM();
+
+            eepromState = EEPROM_WRITE;
+            break;
+
+        case EEPROM_WRITE:
+            if (!writeReg(eepromRegs[eepromIndex], eepromValues[eepromIndex]))
+                return abortEEPROM();
+
+            /* CONFIG now holds the programmed value */
+            if (eepromRegs[eepromIndex] == REG_CONFIG)
+                cacheValid = false;
+
+            eepromStart = millis();
+            eepromState = EEPROM_PROGRAM;
+            break;
+
+        case EEPROM_PROGRAM: {
+            uint16_t ul;
+            if (!readReg(REG_EEPROM_UL, ul))
+                return abortEEPROM();
+
+            if (ul & TMP11X_EEPROM_UL_BUSY) {
+                if (millis() - eepromStart > TMP11X_EEPROM_TIMEOUT_MS) {
+                    status = TMP11X_ERR_TIMEOUT;
+                    return abortEEPROM();
+                }
+                status = TMP11X_OK;
+                return true;
+            }
+
+            eepromIndex++;
+            eepromState = eepromIndex < eepromCount ? EEPROM_WRITE : EEPROM_LOCK;
+            break;
+        }
+
+        case EEPROM_LOCK:
+            if (eepromIndex < eepromCount) {
+                eepromState = EEPROM_WRITE;
+                break;
+            }
+
+            /* Stay in EEPROM_LOCK and retry on the next call */
+            if (!lockEEPROM())
+                return false;
+
+            eepromCount = 0;
+            eepromIndex = 0;
+            eepromState = EEPROM_IDLE;
+            status = TMP11X_OK;
+            return true;
+
+        default: /* EEPROM_RELOCK */
+            if (!lockEEPROM())
+                return false;
+
+            eepromState = EEPROM_IDLE;
+            break;
+        }
+    }
+}
+
+/**
+ * True while an EEPROM session is queued or running.
+ */
+bool TMP11x_7Semi::eepromPending() const {
+    return eepromState != EEPROM_IDLE || eepromIndex < eepromCount;
+}
+
+/**
+ * Run the queued session to completion.
+ */
+uint8_t TMP11x_7Semi::flushEEPROM() {
+    while (eepromPending()) {
+        if (!serviceEEPROM())
+            return false;
+        yield();
+    }
+
+    status = TMP11X_OK;
+    return true;
+}
+
+/* ================= Calibration ================= */
+
+/**
+ * Apply a multi-point calibration to every temperature read.
+ */
+void TMP11x_7Semi::setCalibration(const TMP11x_Calibration *cal) {
+    calibration = cal;
+}
+
+/**
+ * Get the active calibration.
+ */
+const TMP11x_Calibration *TMP11x_7Semi::getCalibration() const {
+    return calibration;
+}
+
+/* ================= Profile ================= */
+
+/**
+ * Persist a complete profile as the power-on defaults.
+ */
+uint8_t TMP11x_7Semi::saveProfile(const TMP11x_Profile &profile) {
+    if (!queueEEPROMWrite(REG_CONFIG, profile.config.word()))
+        return false;
+    if (!queueEEPROMWrite(REG_T_HIGH, (uint16_t)profile.highLimitRaw))
+        return false;
+    if (!queueEEPROMWrite(REG_T_LOW, (uint16_t)profile.lowLimitRaw))
         return false;
+    return queueEEPROMWrite(REG_TEMP_OFFSET, (uint16_t)profile.offsetRaw);
+}
 
-    /**
-     * Write to EEPROM
-     */
-    if (!writeReg(reg, value))
+/**
+ * Compare live registers with a profile and fix the fields that differ.
+ *
+ * - CONFIG is compared on writable bits, with MOD as it reads back
+ */
+uint8_t TMP11x_7Semi::verifyProfile(const TMP11x_Profile &profile, bool persist, uint8_t &mismatches) {
+    static const uint8_t regs[4] = { REG_CONFIG, REG_T_HIGH, REG_T_LOW, REG_TEMP_OFFSET };
+
+    uint16_t expected[4];
+    expected[0] = profile.config.word();
+    expected[1] = (uint16_t)profile.highLimitRaw;
+    expected[2] = (uint16_t)profile.lowLimitRaw;
+    expected[3] = (uint16_t)profile.offsetRaw;
+
+    mismatches = 0;
+
+    for (uint8_t i = 0; i < 4; i++) {
+        uint16_t live;
+        bool same;
+
+        if (regs[i] == REG_CONFIG) {
+            if (!readConfig(live))
+                return false;
+            same = normalizeConfig(live) == normalizeConfig(expected[i]);
+        } else {
+            if (!readReg(regs[i], live))
+                return false;
+            same = live == expected[i];
+        }
+
+        if (same)
+            continue;
+
+        mismatches |= (uint8_t)(1 << i);
+
+        uint8_t ok;
+        if (persist)
+            ok = queueEEPROMWrite(regs[i], expected[i]);
+        else if (regs[i] == REG_CONFIG)
+            ok = writeConfig(expected[i]);
+        else
+            ok = writeReg(regs[i], expected[i]);
+
+        if (!ok)
+            return false;
+    }
+
+    status = TMP11X_OK;
+    return true;
+}
+
+/* ================= Shared Bus ================= */
+
+/**
+ * Serialize register transactions through a bus lock.
+ */
+void TMP11x_7Semi::setBusLock(TMP11x_BusLock *lock, uint32_t timeoutMs) {
+    busLock = lock;
+    busLockTimeoutMs = timeoutMs;
+}
+
+/**
+ * Get the bus lock.
+ */
+TMP11x_BusLock *TMP11x_7Semi::getBusLock() const {
+    return busLock;
+}
+
+/* ================= Queued Transactions ================= */
+
+/**
+ * Side effects of a queued register read.
+ *
+ * - Same as readConfig() / readRawTemperature()
+ */
+void TMP11x_7Semi::completeRead(uint8_t reg, uint16_t &value) {
+    lastPointer = reg;
+    status = TMP11X_OK;
+
+    if (reg == REG_CONFIG) {
+        statusFlags |= value & (TMP11X_CFG_HIGH_ALERT | TMP11X_CFG_LOW_ALERT | TMP11X_CFG_DATA_READY);
+        sampleAlerts |= value & (TMP11X_CFG_HIGH_ALERT | TMP11X_CFG_LOW_ALERT);
+        if (cacheEnabled)
+            cacheConfig(value);
+    } else if (reg == REG_TEMP) {
+        if (calibration)
+            value = (uint16_t)calibration->correct((int16_t)value);
+        statusFlags &= ~TMP11X_CFG_DATA_READY;
+    }
+}
+
+/**
+ * Side effects of a queued register write.
+ *
+ * - Same as writeConfig() / triggerOneShot()
+ */
+void TMP11x_7Semi::completeWrite(uint8_t reg, uint16_t value) {
+    lastPointer = reg;
+    status = TMP11X_OK;
+
+    if (reg != REG_CONFIG)
+        return;
+
+    if (value & TMP11X_CFG_SOFT_RESET) {
+        cacheValid = false;
+        lastPointer = POINTER_UNKNOWN;
+        return;
+    }
+
+    if (cacheEnabled)
+        cacheConfig(value);
+
+    if (((value >> 10) & 0x03) == ONE_SHOT) {
+        oneShotWait = activeTimeMs((TMP11x_AVG)((value >> 5) & 0x03));
+        statusFlags &= ~TMP11X_CFG_DATA_READY;
+        oneShotStart = millis();
+        oneShotState = ONE_SHOT_CONVERTING;
+    }
+}
+
+/**
+ * Deliver a queued temperature read.
+ */
+void TMP11x_7Semi::completeSample(int16_t raw) {
+    oneShotState = ONE_SHOT_IDLE;
+    deliverSample(raw, millis());
+}
+
+/**
+ * Drop cached state after a failed queued transaction.
+ */
+void TMP11x_7Semi::abortTransaction(uint8_t reg, bool write) {
+    lastPointer = POINTER_UNKNOWN;
+
+    if (write && reg == REG_CONFIG) {
+        cacheValid = false;
+        oneShotState = ONE_SHOT_IDLE;
+    }
+}
+
+/* ================= Low-Level I2C ================= */
+
+/**
+ * Read a 16-bit register with retries.
+ */
+uint8_t TMP11x_7Semi::readReg(uint8_t reg, uint16_t &value) {
+#ifdef TMP11X_ENABLE_TIMING
+    uint32_t startUs = micros();
+#endif
+    uint8_t ok = false;
+
+    retryStats.transactions++;
+    for (uint8_t attempt = 0;; attempt++) {
+        if (lockBus()) {
+            ok = readRegOnce(reg, value);
+            unlockBus();
+            if (ok) {
+                if (attempt)
+                    retryStats.recovered++;
+                break;
+            }
+        }
+
+        if (!retryAfterFailure(attempt))
+            break;
+    }
+
+#ifdef TMP11X_ENABLE_TIMING
+    recordTiming(timingStats.read, startUs, ok);
+#endif
+    return ok;
+}
+
+/**
+ * Write a 16-bit register with retries.
+ */
+uint8_t TMP11x_7Semi::writeReg(uint8_t reg, uint16_t value) {
+#ifdef TMP11X_ENABLE_TIMING
+    uint32_t startUs = micros();
+#endif
+    uint8_t ok = false;
+
+    retryStats.transactions++;
+    for (uint8_t attempt = 0;; attempt++) {
+        if (lockBus()) {
+            ok = writeRegOnce(reg, value);
+            unlockBus();
+            if (ok) {
+                if (attempt)
+                    retryStats.recovered++;
+                break;
+            }
+        }
+
+        if (!retryAfterFailure(attempt))
+            break;
+    }
+
+#ifdef TMP11X_ENABLE_TIMING
+    recordTiming(timingStats.write, startUs, ok);
+#endif
+    return ok;
+}
+
+/**
+ * Take the bus lock for one attempt.
+ *
+ * - No lock configured: always succeeds
+ */
+uint8_t TMP11x_7Semi::lockBus() {
+    if (busLock && !busLock->acquire(busLockTimeoutMs))
+        return fail(TMP11X_ERR_LOCK_TIMEOUT);
+    return true;
+}
+
+/**
+ * Release the bus lock.
+ */
+void TMP11x_7Semi::unlockBus() {
+    if (busLock)
+        busLock->release();
+}
+
+/**
+ * Decide whether a failed attempt is retried.
+ *
+ * - Keeps the failure status if the transaction is given up
+ */
+bool TMP11x_7Semi::retryAfterFailure(uint8_t attempt) {
+    TMP11x_Status error = status;
+
+    bool retryable;
+    switch (error) {
+    case TMP11X_ERR_NACK_ADDRESS:
+        retryable = retryPolicy.retryAddressNack;
+        break;
+    case TMP11X_ERR_NACK_DATA:
+    case TMP11X_ERR_BUS:
+    case TMP11X_ERR_TIMEOUT:
+    case TMP11X_ERR_SHORT_READ:
+        retryable = true;
+        break;
+    default:
+        retryable = false;
+        break;
+    }
+
+    if (!retryable || attempt >= retryPolicy.maxRetries) {
+        retryStats.failures++;
         return false;
+    }
 
-    /**
-     * EEPROM internal write delay
-     */
-    delay(10);
+    if (retryPolicy.backoffUs) {
+        uint32_t wait = (uint32_t)retryPolicy.backoffUs << (attempt < 8 ? attempt : 8);
+        if (wait >= 16000)
+            delay(wait / 1000);
+        else
+            delayMicroseconds(wait);
+    }
 
-    /* Lock EEPROM */
-    lockEEPROM();
+    if (retryPolicy.busRecovery && attempt + 1 == retryPolicy.maxRetries &&
+        (error == TMP11X_ERR_TIMEOUT || error == TMP11X_ERR_BUS)) {
+        recoverBus();
+    }
 
+    retryStats.retries++;
     return true;
 }
 
-/* ================= Low-Level I2C ================= */
+/**
+ * Check whether a read must send the pointer.
+ *
+ * - A stale pointer on TEMP returns a wrong sample at worst; on CONFIG
+ *   it would feed the TEMP code into read-modify-write updates
+ */
+bool TMP11x_7Semi::needsPointer(uint8_t reg) const {
+    return !pointerCacheEnabled || reg != REG_TEMP || lastPointer != reg;
+}
 
 /**
  * Read a 16-bit register (MSB first).
  *
  * - Uses a repeated start (endTransmission(false)) for proper register reads
+ * - Skips the pointer write for repeated TEMP reads (see needsPointer())
  */
-uint8_t TMP11x_7Semi::readReg(uint8_t reg, uint16_t &value) {
-    i2c->beginTransmission(address);
-    i2c->write(reg);
-    if (i2c->endTransmission(false) != 0)
-        return false;
+uint8_t TMP11x_7Semi::readRegOnce(uint8_t reg, uint16_t &value) {
+    bool sendPointer = needsPointer(reg);
+#ifdef TMP11X_ENABLE_TIMING
+    if (sendPointer)
+        timingStats.pointerWrites++;
+    else
+        timingStats.pointerSkips++;
+#endif
 
-    if (i2c->requestFrom(address, (uint8_t)2) != 2)
-        return false;
+    if (transport) {
+        TMP11x_Status error = transport->readRegister(address, reg, sendPointer, value);
+        if (error != TMP11X_OK) {
+            lastPointer = POINTER_UNKNOWN;
+            return fail(error);
+        }
+
+        lastPointer = reg;
+        status = TMP11X_OK;
+        return true;
+    }
+
+    if (sendPointer) {
+        lastPointer = POINTER_UNKNOWN;
+
+        i2c->beginTransmission(address);
+        i2c->write(reg);
+        uint8_t err = i2c->endTransmission(false);
+        if (err != 0)
+            return fail(wireStatus(err));
+    }
+
+    uint8_t received = i2c->requestFrom(address, (uint8_t)2);
+    if (received != 2) {
+        /* Drain partial data so the next read starts clean */
+        while (i2c->available())
+            i2c->read();
+        lastPointer = POINTER_UNKNOWN;
+        return fail(received == 0 ? TMP11X_ERR_NACK_ADDRESS : TMP11X_ERR_SHORT_READ);
+    }
 
     value = ((uint16_t)i2c->read() << 8) | i2c->read();
+    lastPointer = reg;
+    status = TMP11X_OK;
     return true;
 }
 
 /**
  * Write a 16-bit register (MSB first).
+ *
+ * - A write also moves the device pointer to reg
  */
-uint8_t TMP11x_7Semi::writeReg(uint8_t reg, uint16_t value) {
+uint8_t TMP11x_7Semi::writeRegOnce(uint8_t reg, uint16_t value) {
+    if (transport) {
+        TMP11x_Status error = transport->writeRegister(address, reg, value);
+        if (error != TMP11X_OK) {
+            lastPointer = POINTER_UNKNOWN;
+            return fail(error);
+        }
+
+        lastPointer = reg;
+        status = TMP11X_OK;
+        return true;
+    }
+
     i2c->beginTransmission(address);
     i2c->write(reg);
     i2c->write(value >> 8);
     i2c->write(value & 0xFF);
-    return (i2c->endTransmission() == 0);
+    uint8_t err = i2c->endTransmission();
+    if (err != 0) {
+        lastPointer = POINTER_UNKNOWN;
+        return fail(wireStatus(err));
+    }
+
+    lastPointer = reg;
+    status = TMP11X_OK;
+    return true;
+}
+
+/**
+ * Record a failure status.
+ */
+uint8_t TMP11x_7Semi::fail(TMP11x_Status error) {
+    status = error;
+    return false;
+}
+
+/**
+ * Map a TwoWire endTransmission() code to TMP11x_Status.
+ */
+TMP11x_Status TMP11x_7Semi::wireStatus(uint8_t code) {
+    switch (code) {
+    case 0:
+        return TMP11X_OK;
+    case 1:
+        return TMP11X_ERR_DATA_TOO_LONG;
+    case 2:
+        return TMP11X_ERR_NACK_ADDRESS;
+    case 3:
+        return TMP11X_ERR_NACK_DATA;
+    case 5:
+        return TMP11X_ERR_TIMEOUT;
+    default:
+        return TMP11X_ERR_BUS;
+    }
 }
 
 /* ================= Helpers ================= */
@@ -523,7 +1978,15 @@ float TMP11x_7Semi::rawToCelsius(int16_t raw) {
  * Convert Celsius to raw TMP117 temperature format.
  *
  * - Inverse of rawToCelsius()
+ * - Rounds half away from zero instead of truncating
  */
 int16_t TMP11x_7Semi::celsiusToRaw(float temp) {
-    return (int16_t)(temp / 0.0078125f);
+    float scaled = temp * 128.0f;
+
+    if (scaled >= 32767.0f)
+        return 32767;
+    if (scaled <= -32768.0f)
+        return -32768;
+
+    return (int16_t)(scaled >= 0.0f ? scaled + 0.5f : scaled - 0.5f);
 }
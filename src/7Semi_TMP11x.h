@@ -48,6 +48,45 @@
 #define REG_EEPROM3        0x08
 #define REG_DEVICE_ID      0x0F
 
+/**
+ * CONFIG register fields.
+ *
+ * - Bits 15:12 are read-only status flags
+ *   - HIGH_Alert / LOW_Alert / Data_Ready clear when CONFIG is read
+ *   - Data_Ready also clears when TEMP is read
+ * - Bit 1 is the self-clearing soft reset
+ * - Bits 11:2 are the writable configuration fields
+ */
+#define TMP11X_CFG_HIGH_ALERT      0x8000
+#define TMP11X_CFG_LOW_ALERT       0x4000
+#define TMP11X_CFG_DATA_READY      0x2000
+#define TMP11X_CFG_EEPROM_BUSY     0x1000
+#define TMP11X_CFG_FLAGS_MASK      0xF000
+#define TMP11X_CFG_SOFT_RESET      0x0002
+#define TMP11X_CFG_WRITABLE_MASK   0x0FFC
+
+/**
+ * EEPROM_UL register fields.
+ *
+ * - Bit 15: EUN, unlocks EEPROM programming
+ * - Bit 14: EEPROM_Busy mirror (reading it does not clear CONFIG flags)
+ */
+#define TMP11X_EEPROM_UL_UNLOCK    0x8000
+#define TMP11X_EEPROM_UL_BUSY      0x4000
+
+/**
+ * Maximum words programmed in one unlock session.
+ *
+ * - Enough for every EEPROM-backed register:
+ *   CONFIG, T_HIGH, T_LOW, TEMP_OFFSET, EEPROM1..3
+ */
+#define TMP11X_EEPROM_QUEUE_SIZE   7
+
+/**
+ * Give up on a program cycle after this long (typical cycle ~7 ms).
+ */
+#define TMP11X_EEPROM_TIMEOUT_MS   50
+
 /* ================= Configuration Options ================= */
 
 /**
@@ -88,6 +127,8 @@ typedef enum {
  *
  * Common mapping:
  * - 0: 15.5 ms (AVG=0), 125 ms (AVG=1), 500 ms (AVG=2), 1 s (AVG=3)
+ * - Cycle time = max(CONV time, AVG active time);
+ *   see TMP11x_7Semi::conversionTimeMs()
  * - 1: 125 ms
  * - 2: 250 ms
  * - 3: 500 ms
@@ -129,6 +170,395 @@ typedef enum {
     ALERT_ACTIVE_HIGH = 1
 } TMP11x_ALERT_POLARITY;
 
+/**
+ * ALERT pin function (CONFIG DR/Alert, bit 2).
+ *
+ * - 0: ALERT pin reflects alert flags
+ * - 1: ALERT pin reflects Data_Ready
+ */
+typedef enum {
+    ALERT_PIN_ALERT      = 0,
+    ALERT_PIN_DATA_READY = 1
+} TMP11x_ALERT_PIN;
+
+/**
+ * Device model (DEVICE_ID DID[11:0]).
+ *
+ * - DEVICE_ID bits 15:12 hold the revision
+ */
+typedef enum {
+    MODEL_UNKNOWN = 0x000,
+    MODEL_TMP116  = 0x116,
+    MODEL_TMP117  = 0x117
+} TMP11x_MODEL;
+
+/**
+ * Operation status.
+ *
+ * - Every public method records one of these; read it with lastError()
+ * - Methods keep returning true/false so existing sketches are unaffected
+ * - Values 1..5 match TwoWire endTransmission() codes
+ *
+ * - TMP11X_OK: success
+ * - TMP11X_ERR_DATA_TOO_LONG: transmit buffer overflow
+ * - TMP11X_ERR_NACK_ADDRESS: address not acknowledged (device absent or busy)
+ * - TMP11X_ERR_NACK_DATA: data byte not acknowledged
+ * - TMP11X_ERR_BUS: other bus error (arbitration lost, etc.)
+ * - TMP11X_ERR_TIMEOUT: bus timeout
+ * - TMP11X_ERR_SHORT_READ: fewer bytes received than requested
+ * - TMP11X_ERR_DEVICE_ID: device responded with an unexpected ID
+ * - TMP11X_ERR_INVALID_ARG: argument out of range / resource unavailable
+ * - TMP11X_ERR_NOT_READY: no new data (not a bus failure)
+ * - TMP11X_ERR_BUSY: device or state machine busy
+ * - TMP11X_ERR_LOCK_TIMEOUT: shared-bus lock not obtained in time
+ */
+typedef enum {
+    TMP11X_OK                = 0,
+    TMP11X_ERR_DATA_TOO_LONG = 1,
+    TMP11X_ERR_NACK_ADDRESS  = 2,
+    TMP11X_ERR_NACK_DATA     = 3,
+    TMP11X_ERR_BUS           = 4,
+    TMP11X_ERR_TIMEOUT       = 5,
+    TMP11X_ERR_SHORT_READ    = 6,
+    TMP11X_ERR_DEVICE_ID     = 7,
+    TMP11X_ERR_INVALID_ARG   = 8,
+    TMP11X_ERR_NOT_READY     = 9,
+    TMP11X_ERR_BUSY          = 10,
+    TMP11X_ERR_LOCK_TIMEOUT  = 11
+} TMP11x_Status;
+
+class TMP11x_BusLock;
+class TMP11x_Calibration;
+class TMP11x_Transport;
+
+/**
+ * Retry / backoff / bus-recovery policy for register transactions.
+ *
+ * - maxRetries: extra attempts after the first failure (0 = no retry)
+ * - backoffUs: wait before the first retry, doubled on each further retry
+ * - retryAddressNack: also retry TMP11X_ERR_NACK_ADDRESS
+ *   - Off by default: an address NACK usually means the device is absent
+ * - busRecovery: before the last retry of a timeout / bus error,
+ *   clock SCL to release a stuck SDA, send STOP and re-init Wire
+ */
+struct TMP11x_RetryPolicy {
+    uint8_t maxRetries;
+    uint16_t backoffUs;
+    bool retryAddressNack;
+    bool busRecovery;
+
+    constexpr TMP11x_RetryPolicy(uint8_t retries = 0,
+                                 uint16_t backoff = 0,
+                                 bool addressNack = false,
+                                 bool recovery = false)
+        : maxRetries(retries), backoffUs(backoff), retryAddressNack(addressNack), busRecovery(recovery) {}
+};
+
+/**
+ * Retry counters.
+ *
+ * - transactions: register reads / writes issued (first attempts)
+ * - retries: retry attempts made
+ * - recovered: transactions that succeeded after at least one retry
+ * - failures: transactions that failed after all attempts
+ * - busRecoveries: bus-recovery passes executed
+ */
+struct TMP11x_RetryStats {
+    uint32_t transactions;
+    uint32_t retries;
+    uint32_t recovered;
+    uint32_t failures;
+    uint32_t busRecoveries;
+};
+
+/**
+ * Timing counters for one register direction.
+ *
+ * - count / failures: readReg() / writeReg() calls and failed calls
+ * - totalUs / maxUs: micros() per call, including retries and bus lock
+ */
+struct TMP11x_TimingCounter {
+    uint32_t count;
+    uint32_t failures;
+    uint32_t totalUs;
+    uint32_t maxUs;
+
+    /**
+     * Mean time per call in microseconds.
+     */
+    uint32_t averageUs() const {
+        return count ? totalUs / count : 0;
+    }
+};
+
+/**
+ * Register path instrumentation (TMP11X_ENABLE_TIMING builds).
+ *
+ * - read / write: per-direction call timing
+ * - pointerWrites / pointerSkips: read attempts with / without the
+ *   pointer write (pointer cache savings)
+ * - cacheHits / cacheMisses: CONFIG served from the shadow cache / bus
+ *
+ * Notes:
+ * - Enable with a global build flag (-DTMP11X_ENABLE_TIMING) so the
+ *   library and the sketch see the same class layout
+ */
+struct TMP11x_TimingStats {
+    TMP11x_TimingCounter read;
+    TMP11x_TimingCounter write;
+    uint32_t pointerWrites;
+    uint32_t pointerSkips;
+    uint32_t cacheHits;
+    uint32_t cacheMisses;
+};
+
+/**
+ * Sample callback.
+ *
+ * - rawTemperature: signed raw code (°C = raw * 0.0078125)
+ * - timestampMs: millis() captured when the sample became available
+ */
+typedef void (*TMP11x_SampleCallback)(int16_t rawTemperature, uint32_t timestampMs);
+
+/**
+ * Receiver for fresh samples.
+ *
+ * - Attach with TMP11x_7Semi::addSampleSink()
+ * - Called for every new conversion delivered by the data-ready paths:
+ *   readRawTemperatureIfReady(), fetchRaw(), service()
+ * - flags: TMP11X_CFG_* bits; Data_Ready plus the HIGH_Alert / LOW_Alert
+ *   bits seen by CONFIG reads since the previous sample (not latched)
+ * - Runs in normal (non-interrupt) context
+ */
+class TMP11x_SampleSink {
+public:
+    virtual void onSample(int16_t rawTemperature, uint32_t timestampMs, uint16_t flags) = 0;
+
+protected:
+    TMP11x_SampleSink() : nextSink(NULL) {}
+    ~TMP11x_SampleSink() {}
+
+private:
+    TMP11x_SampleSink *nextSink;
+
+    friend class TMP11x_7Semi;
+};
+
+/**
+ * Maximum number of instances that can use ALERT pin interrupts at once.
+ */
+#ifndef TMP11X_MAX_IRQ_SENSORS
+#define TMP11X_MAX_IRQ_SENSORS 4
+#endif
+
+/* ================= Fixed-Point Temperature ================= */
+
+/**
+ * Integer temperature conversions.
+ *
+ * - 1 LSB = 2^-7 °C exactly, so conversions need only multiply + shift
+ * - Results are rounded to nearest
+ * - Safe on FPU-less MCUs: no float code is pulled in
+ */
+
+/**
+ * Clamp to the signed 16-bit register range.
+ */
+constexpr int16_t TMP11x_clampRaw(int32_t value) {
+    return value > 32767 ? (int16_t)32767 : (value < -32768 ? (int16_t)-32768 : (int16_t)value);
+}
+
+/**
+ * Raw code to milli-degrees Celsius (raw * 1000 / 128).
+ */
+constexpr int32_t TMP11x_rawToMilliC(int16_t raw) {
+    return ((int32_t)raw * 125 + 8) >> 4;
+}
+
+/**
+ * Raw code to centi-degrees Celsius (raw * 100 / 128).
+ */
+constexpr int16_t TMP11x_rawToCentiC(int16_t raw) {
+    return (int16_t)(((int32_t)raw * 25 + 16) >> 5);
+}
+
+/**
+ * Milli-degrees Celsius to raw code (milliC * 128 / 1000), clamped.
+ */
+constexpr int16_t TMP11x_milliCToRaw(int32_t milliC) {
+    return TMP11x_clampRaw((milliC * 32 + (milliC >= 0 ? 125 : -125)) / 250);
+}
+
+/**
+ * Q8.7 fixed-point temperature.
+ *
+ * - Same bit layout as the TEMP register: 8 integer bits, 7 fraction bits
+ */
+struct TMP11x_Q8_7 {
+    int16_t raw;
+
+    constexpr TMP11x_Q8_7(int16_t value = 0) : raw(value) {}
+
+    /**
+     * Whole degrees (rounded toward -infinity).
+     */
+    constexpr int16_t integer() const {
+        return raw >> 7;
+    }
+
+    /**
+     * Fraction in 1/128 °C steps (0..127).
+     */
+    constexpr uint8_t fraction() const {
+        return raw & 0x7F;
+    }
+
+    constexpr int32_t milliC() const {
+        return TMP11x_rawToMilliC(raw);
+    }
+
+    constexpr int16_t centiC() const {
+        return TMP11x_rawToCentiC(raw);
+    }
+};
+
+/* ================= Configuration Word ================= */
+
+/**
+ * Complete CONFIG register settings.
+ *
+ * - Defaults match the device power-on state (CONFIG = 0x0220)
+ * - word() is constexpr, so literal settings fold to a constant
+ * - with*() return a modified copy for builder-style use
+ *
+ * Example:
+ * - constexpr TMP11x_Config cfg = TMP11x_Config().withConversionRate(CONV_1S).withAveraging(AVG_32);
+ */
+struct TMP11x_Config {
+    TMP11x_MODE mode;
+    TMP11x_CONV conversionRate;
+    TMP11x_AVG averaging;
+    TMP11x_THERM_ALERT thermAlert;
+    TMP11x_ALERT_POLARITY polarity;
+    TMP11x_ALERT_PIN alertPin;
+
+    constexpr TMP11x_Config(TMP11x_MODE m = CONTINUOUS_0,
+                            TMP11x_CONV conv = CONV_1S,
+                            TMP11x_AVG avg = AVG_8,
+                            TMP11x_THERM_ALERT tm = ALERT_MODE,
+                            TMP11x_ALERT_POLARITY pol = ALERT_ACTIVE_LOW,
+                            TMP11x_ALERT_PIN pin = ALERT_PIN_ALERT)
+        : mode(m), conversionRate(conv), averaging(avg), thermAlert(tm), polarity(pol), alertPin(pin) {}
+
+    constexpr TMP11x_Config withMode(TMP11x_MODE m) const {
+        return TMP11x_Config(m, conversionRate, averaging, thermAlert, polarity, alertPin);
+    }
+
+    constexpr TMP11x_Config withConversionRate(TMP11x_CONV conv) const {
+        return TMP11x_Config(mode, conv, averaging, thermAlert, polarity, alertPin);
+    }
+
+    constexpr TMP11x_Config withAveraging(TMP11x_AVG avg) const {
+        return TMP11x_Config(mode, conversionRate, avg, thermAlert, polarity, alertPin);
+    }
+
+    constexpr TMP11x_Config withThermAlert(TMP11x_THERM_ALERT tm) const {
+        return TMP11x_Config(mode, conversionRate, averaging, tm, polarity, alertPin);
+    }
+
+    constexpr TMP11x_Config withPolarity(TMP11x_ALERT_POLARITY pol) const {
+        return TMP11x_Config(mode, conversionRate, averaging, thermAlert, pol, alertPin);
+    }
+
+    constexpr TMP11x_Config withAlertPin(TMP11x_ALERT_PIN pin) const {
+        return TMP11x_Config(mode, conversionRate, averaging, thermAlert, polarity, pin);
+    }
+
+    /**
+     * Build the 16-bit CONFIG word.
+     */
+    constexpr uint16_t word() const {
+        return (uint16_t)((((uint16_t)mode & 0x03) << 10) |
+                          (((uint16_t)conversionRate & 0x07) << 7) |
+                          (((uint16_t)averaging & 0x03) << 5) |
+                          (((uint16_t)thermAlert & 0x01) << 4) |
+                          (((uint16_t)polarity & 0x01) << 3) |
+                          (((uint16_t)alertPin & 0x01) << 2));
+    }
+};
+
+/**
+ * Power-on profile: the EEPROM-backed registers as one value.
+ *
+ * - config: CONFIG fields (loaded at power-on)
+ * - highLimitRaw / lowLimitRaw / offsetRaw: T_HIGH / T_LOW / TEMP_OFFSET codes
+ * - Defaults match a factory-fresh device (limits 192 / -256 °C, no offset)
+ * - Build with with*() like TMP11x_Config; limits / offset in m°C
+ */
+struct TMP11x_Profile {
+    TMP11x_Config config;
+    int16_t highLimitRaw;
+    int16_t lowLimitRaw;
+    int16_t offsetRaw;
+
+    constexpr explicit TMP11x_Profile(const TMP11x_Config &cfg = TMP11x_Config(),
+                                      int16_t high = 0x6000,
+                                      int16_t low = (int16_t)0x8000,
+                                      int16_t offset = 0)
+        : config(cfg), highLimitRaw(high), lowLimitRaw(low), offsetRaw(offset) {}
+
+    constexpr TMP11x_Profile withConfig(const TMP11x_Config &cfg) const {
+        return TMP11x_Profile(cfg, highLimitRaw, lowLimitRaw, offsetRaw);
+    }
+
+    constexpr TMP11x_Profile withHighLimitMilliC(int32_t milliC) const {
+        return TMP11x_Profile(config, TMP11x_milliCToRaw(milliC), lowLimitRaw, offsetRaw);
+    }
+
+    constexpr TMP11x_Profile withLowLimitMilliC(int32_t milliC) const {
+        return TMP11x_Profile(config, highLimitRaw, TMP11x_milliCToRaw(milliC), offsetRaw);
+    }
+
+    constexpr TMP11x_Profile withOffsetMilliC(int32_t milliC) const {
+        return TMP11x_Profile(config, highLimitRaw, lowLimitRaw, TMP11x_milliCToRaw(milliC));
+    }
+};
+
+/**
+ * Driver state kept across MCU deep sleep.
+ *
+ * - Place in retained memory (RTC_DATA_ATTR on ESP32)
+ * - Filled by retainState(), consumed by quickBegin()
+ * - Zeroed memory (cold boot) is rejected through magic
+ * - Only valid while the sensor stays powered and nothing else
+ *   reconfigures it
+ */
+struct TMP11x_RetainedState {
+    uint16_t magic;
+    uint8_t address;
+    uint8_t sda;
+    uint8_t scl;
+    uint8_t flags;
+    uint16_t deviceId;
+    uint16_t config;
+    uint32_t clock;
+};
+
+/**
+ * TMP11x_RetainedState magic / flags.
+ */
+#define TMP11X_RETAINED_MAGIC        0x7117
+#define TMP11X_RETAINED_CACHE_ON     0x01
+#define TMP11X_RETAINED_CONFIG_VALID 0x02
+
+/**
+ * Profile field bits reported by verifyProfile().
+ */
+#define TMP11X_PROFILE_CONFIG      0x01
+#define TMP11X_PROFILE_HIGH_LIMIT  0x02
+#define TMP11X_PROFILE_LOW_LIMIT   0x04
+#define TMP11X_PROFILE_OFFSET      0x08
+
 /* ================= TMP11x Class ================= */
 
 class TMP11x_7Semi {
@@ -140,6 +570,14 @@ public:
      */
     TMP11x_7Semi(TwoWire &wirePort = Wire);
 
+    /**
+     * Constructor for a custom transport (see 7Semi_TMP11x_Transport.h).
+     *
+     * - Register transactions go through transport instead of Wire
+     * - begin() skips Wire setup; recoverBus() is not available
+     */
+    TMP11x_7Semi(TMP11x_Transport &transport);
+
     /**
      * Initialize TMP116/TMP117 sensor.
      *
@@ -148,16 +586,139 @@ public:
      *   - ESP32/ESP8266 only: specify custom pins
      *   - Use 0xFF to keep default pins
      * - i2cClockSpeed: I2C bus speed in Hz (default 400000)
+     * - initializeBus: false if Wire is already set up by other code
+     *   (pins / clock are still stored for recoverBus())
      *
      * - Returns:
      *   - true if device responds and DEVICE_ID is valid
      *   - false if device not found or wrong device
      */
     bool begin(uint8_t i2cAddress = 0x48,
+               uint8_t sda = 0xFF,
+               uint8_t scl = 0xFF,
+               uint32_t i2cClockSpeed = 400000,
+               bool initializeBus = true);
+
+    /**
+     * Warm start from retained state, without probing the device.
+     *
+     * - For wakes from MCU deep sleep while the sensor stayed powered
+     * - Restores address, identity and the config cache: no I2C traffic
+     * - initializeBus: set up Wire with the retained pins / clock
+     * - Returns false (no changes) if state is not valid; fall back to begin()
+     */
+    bool quickBegin(const TMP11x_RetainedState &state, bool initializeBus = true);
+
+    /**
+     * Save driver state for quickBegin() after the next wake.
+     *
+     * - Call right before entering deep sleep
+     */
+    void retainState(TMP11x_RetainedState &state) const;
+
+    /**
+     * Initialize and make sure the device runs the given profile.
+     *
+     * - Same bus setup as begin()
+     * - Reads CONFIG / T_HIGH / T_LOW / TEMP_OFFSET once
+     * - Fields that differ are written and persisted to EEPROM, so the
+     *   next power-on loads them and boots cause no EEPROM wear
+     * - Returns once any EEPROM programming has finished
+     */
+    bool begin(const TMP11x_Profile &profile,
+               uint8_t i2cAddress = 0x48,
                uint8_t sda = 0xFF,
                uint8_t scl = 0xFF,
                uint32_t i2cClockSpeed = 400000);
 
+    /**
+     * Attach to a sensor on an already initialized I2C bus.
+     *
+     * - Does not call Wire begin() / setClock()
+     * - Use when the bus is shared with other drivers or instances
+     *
+     * - Returns:
+     *   - true if device responds and DEVICE_ID is valid
+     */
+    bool attach(uint8_t i2cAddress = 0x48);
+
+    /**
+     * Get the 7-bit I2C address used by this instance.
+     */
+    uint8_t getAddress() const;
+
+    /* ================= Status ================= */
+
+    /**
+     * Status of the most recent operation.
+     *
+     * - TMP11X_ERR_NACK_ADDRESS usually means the device is absent
+     * - TMP11X_ERR_NACK_DATA / TIMEOUT / SHORT_READ / BUS are bus glitches
+     */
+    TMP11x_Status lastError() const;
+
+    /* ================= Retry / Recovery ================= */
+
+    /**
+     * Set retry policy applied inside every register read/write.
+     *
+     * - Default: no retries (single attempt)
+     */
+    void setRetryPolicy(const TMP11x_RetryPolicy &policy);
+
+    /**
+     * Get current retry policy.
+     */
+    const TMP11x_RetryPolicy &getRetryPolicy() const;
+
+    /**
+     * Get retry counters.
+     */
+    const TMP11x_RetryStats &getRetryStats() const;
+
+    /**
+     * Clear retry counters.
+     */
+    void resetRetryStats();
+
+#ifdef TMP11X_ENABLE_TIMING
+    /**
+     * Get register path timing counters.
+     */
+    const TMP11x_TimingStats &getTimingStats() const;
+
+    /**
+     * Clear timing counters.
+     */
+    void resetTimingStats();
+#endif
+
+    /**
+     * Release a stuck bus and re-initialize Wire.
+     *
+     * - Clocks SCL up to 9 times until SDA is released, then sends STOP
+     * - Uses the SDA/SCL pins given to begin(), or board SDA/SCL defaults
+     * - Returns true if SDA is high afterwards
+     */
+    uint8_t recoverBus();
+
+    /* ================= Shared Bus ================= */
+
+    /**
+     * Serialize register transactions through a bus lock.
+     *
+     * - Share one lock between all drivers / tasks on the same TwoWire
+     * - The lock is held per attempt; retry backoff runs unlocked
+     * - lock = NULL (default) disables locking
+     * - Fails with TMP11X_ERR_LOCK_TIMEOUT if not obtained within timeoutMs
+     */
+    void setBusLock(TMP11x_BusLock *lock, uint32_t timeoutMs = 100);
+
+    /**
+     * Get the bus lock (NULL if none).
+     */
+    TMP11x_BusLock *getBusLock() const;
+
     /* ================= Temperature ================= */
 
     /**
@@ -179,6 +740,65 @@ public:
      */
     uint8_t readTemperatureF(float &temperatureF);
 
+    /**
+     * Read temperature in milli-degrees Celsius (integer only).
+     */
+    uint8_t readTemperatureMilliC(int32_t &temperatureMilliC);
+
+    /**
+     * Read temperature in centi-degrees Celsius (integer only).
+     */
+    uint8_t readTemperatureCentiC(int16_t &temperatureCentiC);
+
+    /**
+     * Read temperature as Q8.7 fixed point.
+     */
+    uint8_t readTemperatureQ8_7(TMP11x_Q8_7 &temperature);
+
+    /* ================= Data Ready ================= */
+
+    /**
+     * Check for a new conversion result (CONFIG Data_Ready).
+     *
+     * - No bus traffic if Data_Ready was already seen by an earlier CONFIG read
+     * - Otherwise reads CONFIG once
+     * - ready stays true until the temperature is read
+     */
+    uint8_t isDataReady(bool &ready);
+
+    /**
+     * Read raw temperature only when a new result is available.
+     *
+     * - Returns false without reading TEMP when no new sample exists
+     */
+    uint8_t readRawTemperatureIfReady(int16_t &rawTemperature);
+
+    /**
+     * Read temperature in Celsius only when a new result is available.
+     *
+     * - Returns false without reading TEMP when no new sample exists
+     */
+    uint8_t readTemperatureIfReady(float &temperatureC);
+
+    /* ================= Status Flags ================= */
+
+    /**
+     * Read CONFIG status flags.
+     *
+     * - Reading CONFIG clears flags in the device, so every CONFIG read
+     *   made by the library is collected here
+     * - Returns TMP11X_CFG_* flag bits seen since the previous call
+     * - HIGH_Alert / LOW_Alert are cleared from the collected set and
+     *   are not forwarded with the next sample
+     * - Data_Ready stays set until the temperature is read
+     */
+    uint8_t readStatusFlags(uint16_t &flags);
+
+    /**
+     * Get collected status flags without bus traffic.
+     */
+    uint16_t pendingStatusFlags() const;
+
     /* ================= Configuration ================= */
 
     /**
@@ -198,6 +818,39 @@ public:
      */
     uint8_t reset();
 
+    /**
+     * Apply all CONFIG fields in one write.
+     *
+     * - No read-back: the whole word is built from cfg
+     * - Device never runs with partially applied settings
+     */
+    uint8_t configure(const TMP11x_Config &cfg);
+
+    /* ================= Config Cache ================= */
+
+    /**
+     * Enable or disable the CONFIG shadow cache.
+     *
+     * - When enabled:
+     *   - Setters write CONFIG once (no read-modify-write)
+     *   - Getters return cached bits with no bus traffic
+     * - Enabling loads the cache from the device
+     * - Disabled by default
+     */
+    uint8_t enableConfigCache(bool enable = true);
+
+    /**
+     * Check whether the CONFIG shadow cache is enabled.
+     */
+    bool isConfigCacheEnabled() const;
+
+    /**
+     * Reload the CONFIG shadow cache from the device.
+     *
+     * - Call after reset() or when CONFIG was changed externally
+     */
+    uint8_t syncConfig();
+
     /* ================= Conversion Rate ================= */
 
     /**
@@ -215,6 +868,55 @@ public:
      */
     uint8_t getConversionRate(uint8_t &conversionRate);
 
+    /* ================= Conversion Timing ================= */
+
+    /**
+     * Active conversion time for an AVG setting (ms, rounded up).
+     *
+     * - AVG_NONE: 16 (15.5 ms), AVG_8: 125, AVG_32: 500, AVG_64: 1000
+     * - Also the one-shot conversion time
+     */
+    static constexpr uint16_t activeTimeMs(TMP11x_AVG avg) {
+        return avg == AVG_8 ? 125 : (avg == AVG_32 ? 500 : (avg == AVG_64 ? 1000 : 16));
+    }
+
+    /**
+     * Continuous-mode cycle time selected by CONV alone (ms, rounded up).
+     */
+    static constexpr uint16_t conversionCycleMs(TMP11x_CONV conv) {
+        return conv == CONV_125MS ? 125 :
+               conv == CONV_250MS ? 250 :
+               conv == CONV_500MS ? 500 :
+               conv == CONV_1S    ? 1000 :
+               conv == CONV_4S    ? 4000 :
+               conv == CONV_8S    ? 8000 :
+               conv == CONV_16S   ? 16000 : 16;
+    }
+
+    /**
+     * Continuous-mode cycle time for a CONV x AVG pair (ms).
+     *
+     * - max(CONV cycle, AVG active time), per datasheet table
+     * - Standby time per cycle = conversionTimeMs() - activeTimeMs()
+     */
+    static constexpr uint16_t conversionTimeMs(TMP11x_CONV conv, TMP11x_AVG avg) {
+        return conversionCycleMs(conv) > activeTimeMs(avg) ? conversionCycleMs(conv) : activeTimeMs(avg);
+    }
+
+    /**
+     * Cycle time of the current configuration (ms).
+     *
+     * - Served from the config cache when enabled
+     */
+    uint8_t getConversionTimeMs(uint16_t &timeMs);
+
+    /**
+     * Active (one-shot) time of the current configuration (ms).
+     *
+     * - Served from the config cache when enabled
+     */
+    uint8_t getActiveTimeMs(uint16_t &timeMs);
+
     /* ================= Averaging ================= */
 
     /**
@@ -232,6 +934,14 @@ public:
      */
     uint8_t getAveraging(uint8_t &avg);
 
+    /**
+     * Set conversion rate and averaging in one CONFIG write.
+     *
+     * - Same as setConversionRate() + setAveraging(), one transaction
+     *   when the config cache is enabled
+     */
+    uint8_t setConversionTiming(TMP11x_CONV conversionRate, TMP11x_AVG avg);
+
     /* ================= Power / Mode ================= */
 
     /**
@@ -253,6 +963,62 @@ public:
      */
     uint8_t getMode(uint8_t &mode);
 
+    /* ================= One-Shot (Non-Blocking) ================= */
+
+    /**
+     * Start a one-shot conversion without blocking.
+     *
+     * - Expected conversion time follows the current AVG setting
+     * - Device returns to shutdown by itself afterwards
+     * - Enable the config cache to make this a single CONFIG write
+     */
+    uint8_t startOneShot();
+
+    /**
+     * Advance the one-shot state machine.
+     *
+     * - No bus traffic before the expected conversion time
+     * - Then checks Data_Ready (one CONFIG read per call)
+     * - Returns true once Data_Ready is set or the deadline has passed
+     */
+    bool poll();
+
+    /**
+     * Check whether the started one-shot has completed.
+     *
+     * - No bus traffic; reflects the last poll()
+     */
+    bool isConversionDone() const;
+
+    /**
+     * Fetch the one-shot result (raw code).
+     *
+     * - Returns false if no completed one-shot is pending
+     */
+    uint8_t fetchRaw(int16_t &rawTemperature);
+
+    /**
+     * Fetch the one-shot result in Celsius.
+     */
+    uint8_t fetch(float &temperatureC);
+
+    /* ================= Register Pointer Cache ================= */
+
+    /**
+     * Enable or disable register pointer caching.
+     *
+     * - Device keeps its pointer register between transactions
+     * - Repeated TEMP reads skip the pointer write
+     *   (bare 2-byte read instead of address + pointer + repeated start)
+     * - All other registers (CONFIG, limits, offset, EEPROM, ID) always
+     *   send the pointer, so a pointer moved behind the driver's back
+     *   (power cycle, general-call reset, raw Wire use) can never make a
+     *   CONFIG read-modify-write use the TEMP code
+     * - Tracking is reset after a failed transaction and after reset()
+     * - Enabled by default; disable if another master reads this device
+     */
+    void enablePointerCache(bool enable = true);
+
     /* ================= Alert Limits ================= */
 
     /**
@@ -275,6 +1041,14 @@ public:
      */
     uint8_t getLowLimit(float &tempC);
 
+    /**
+     * Integer limit access in milli-degrees Celsius.
+     */
+    uint8_t setHighLimitMilliC(int32_t milliC);
+    uint8_t setLowLimitMilliC(int32_t milliC);
+    uint8_t getHighLimitMilliC(int32_t &milliC);
+    uint8_t getLowLimitMilliC(int32_t &milliC);
+
     /* ================= Offset ================= */
 
     /**
@@ -290,6 +1064,12 @@ public:
      */
     uint8_t getOffset(float &offsetC);
 
+    /**
+     * Integer offset access in milli-degrees Celsius.
+     */
+    uint8_t setOffsetMilliC(int32_t milliC);
+    uint8_t getOffsetMilliC(int32_t &milliC);
+
     /* ================= Therm / Alert Mode ================= */
 
     /**
@@ -328,6 +1108,71 @@ public:
      */
     uint8_t getAlertPolarity(uint8_t &active_high);
 
+    /* ================= ALERT Pin Function ================= */
+
+    /**
+     * Select ALERT pin function (CONFIG DR/Alert).
+     *
+     * - Use TMP11x_ALERT_PIN:
+     *   - ALERT_PIN_ALERT
+     *   - ALERT_PIN_DATA_READY
+     */
+    uint8_t setAlertPinFunction(TMP11x_ALERT_PIN function);
+
+    /**
+     * Get ALERT pin function (CONFIG DR/Alert).
+     *
+     * - Returns raw value 0..1
+     * - Cast to TMP11x_ALERT_PIN if needed
+     */
+    uint8_t getAlertPinFunction(uint8_t &function);
+
+    /* ================= Data Ready Interrupt ================= */
+
+    /**
+     * Route Data_Ready to the ALERT pin and attach an MCU interrupt.
+     *
+     * - pin: MCU GPIO connected to ALERT (open-drain, needs pull-up)
+     * - callback: called from service() with each new sample
+     * - Edge follows the current ALERT polarity
+     * - ISR only timestamps and flags; no I2C inside the interrupt
+     */
+    uint8_t attachDataReadyInterrupt(uint8_t pin, TMP11x_SampleCallback callback);
+
+    /**
+     * Detach the ALERT pin interrupt.
+     */
+    void detachDataReadyInterrupt();
+
+    /**
+     * Service sample acquisition from the main loop.
+     *
+     * - With a data-ready interrupt: reads TEMP only when the ISR flagged a sample
+     * - Without: checks Data_Ready and reads TEMP only when a new sample exists
+     * - New samples go to the callback and all sample sinks
+     * - Returns true if a sample was delivered
+     */
+    uint8_t service();
+
+    /* ================= Sample Sinks ================= */
+
+    /**
+     * Attach a sample sink (ring buffer, statistics, filter, ...).
+     *
+     * - Sinks are chained; each sink can be attached to one sensor only
+     */
+    void addSampleSink(TMP11x_SampleSink &sink);
+
+    /**
+     * Detach a sample sink.
+     */
+    void removeSampleSink(TMP11x_SampleSink &sink);
+
+    /**
+     * millis() timestamp of the last delivered sample.
+     */
+    uint32_t lastSampleTime() const;
+
     /* ================= EEPROM ================= */
 
     /**
@@ -347,10 +1192,87 @@ public:
      *   - REG_EEPROM1
      *   - REG_EEPROM2
      *   - REG_EEPROM3
-     * - EEPROM programming takes time; library applies a short delay after write
+     * - Blocking: waits for the program cycle via EEPROM_Busy (no fixed delay)
      */
     uint8_t writeEEPROM(uint8_t reg, uint16_t value);
 
+    /**
+     * Queue one word for non-blocking EEPROM programming.
+     *
+     * - Allowed:
+     *   - REG_EEPROM1 / REG_EEPROM2 / REG_EEPROM3
+     *   - REG_CONFIG / REG_T_HIGH / REG_T_LOW / REG_TEMP_OFFSET
+     *     (power-on defaults)
+     * - A register already queued but not yet written is overwritten
+     * - All queued words share one unlock / lock session
+     * - Fails with TMP11X_ERR_BUSY if the queue is full
+     */
+    uint8_t queueEEPROMWrite(uint8_t reg, uint16_t value);
+
+    /**
+     * Advance the EEPROM session; call from loop().
+     *
+     * - Unlock -> write -> poll EEPROM_Busy -> next word ... -> lock
+     * - Never waits; each call does at most a few register transactions
+     * - On error the remaining words are dropped, EEPROM is re-locked
+     *   and false is returned (see lastError())
+     * - While a session runs, every register write is programmed into
+     *   EEPROM: avoid other setters until eepromPending() is false
+     */
+    uint8_t serviceEEPROM();
+
+    /**
+     * True while words are queued or the session is still locking.
+     */
+    bool eepromPending() const;
+
+    /**
+     * Run the queued session to completion (blocking).
+     *
+     * - Finishes as soon as the last program cycle ends
+     */
+    uint8_t flushEEPROM();
+
+    /* ================= Calibration ================= */
+
+    /**
+     * Apply a multi-point calibration to every temperature read.
+     *
+     * - Corrects the raw code in readRawTemperature(), so all units,
+     *   sinks and callbacks see calibrated values
+     * - TEMP_OFFSET must hold calibration.offsetRaw()
+     *   (applyOffset() / saveToEEPROM())
+     * - NULL (default) disables correction; use while collecting
+     *   reference readings
+     */
+    void setCalibration(const TMP11x_Calibration *calibration);
+
+    /**
+     * Get the active calibration (NULL if none).
+     */
+    const TMP11x_Calibration *getCalibration() const;
+
+    /* ================= Profile ================= */
+
+    /**
+     * Persist a complete profile as the power-on defaults.
+     *
+     * - Queues CONFIG / T_HIGH / T_LOW / TEMP_OFFSET on the EEPROM writer
+     * - Drive with serviceEEPROM() or flushEEPROM()
+     */
+    uint8_t saveProfile(const TMP11x_Profile &profile);
+
+    /**
+     * Compare live registers with a profile and fix the fields that differ.
+     *
+     * - One read per field; matching fields are not written
+     * - persist = false: differing fields are written to the registers only
+     * - persist = true: differing fields are queued on the EEPROM writer
+     *   (registers update as the session runs)
+     * - mismatches: TMP11X_PROFILE_* bits of the fields that differed
+     */
+    uint8_t verifyProfile(const TMP11x_Profile &profile, bool persist, uint8_t &mismatches);
+
     /* ================= Device ================= */
 
     /**
@@ -358,25 +1280,191 @@ public:
      *
      * - TMP117 expected value: 0x0117
      * - TMP116 expected value differs by variant
+     * - Also refreshes deviceModel() / deviceRevision()
      */
     uint8_t getDeviceID(uint16_t &deviceID);
 
+    /**
+     * Model found by begin() / attach() (no bus traffic).
+     */
+    TMP11x_MODEL deviceModel() const;
+
+    /**
+     * Silicon revision found by begin() / attach() (DEVICE_ID[15:12]).
+     */
+    uint8_t deviceRevision() const;
+
 private:
     TwoWire *i2c;
+    TMP11x_Transport *transport;
     uint8_t address;
+    uint16_t deviceId;
+
+    TMP11x_Status status;
+
+    uint8_t busSda;
+    uint8_t busScl;
+    uint32_t busClock;
+
+    TMP11x_RetryPolicy retryPolicy;
+    TMP11x_RetryStats retryStats;
+
+#ifdef TMP11X_ENABLE_TIMING
+    TMP11x_TimingStats timingStats;
+
+    /**
+     * Add one readReg() / writeReg() call to a timing counter.
+     */
+    static void recordTiming(TMP11x_TimingCounter &counter, uint32_t startUs, uint8_t ok);
+#endif
+
+    TMP11x_BusLock *busLock;
+    uint32_t busLockTimeoutMs;
+
+    const TMP11x_Calibration *calibration;
+
+    uint8_t lastPointer;
+    bool pointerCacheEnabled;
+
+    uint16_t configCache;
+    bool cacheEnabled;
+    bool cacheValid;
+
+    uint16_t statusFlags;
+    uint16_t sampleAlerts;
+
+    uint8_t eepromRegs[TMP11X_EEPROM_QUEUE_SIZE];
+    uint16_t eepromValues[TMP11X_EEPROM_QUEUE_SIZE];
+    uint8_t eepromCount;
+    uint8_t eepromIndex;
+    uint8_t eepromState;
+    uint32_t eepromStart;
+
+    uint8_t oneShotState;
+    uint32_t oneShotStart;
+    uint16_t oneShotWait;
+
+    volatile bool irqPending;
+    volatile uint32_t irqTime;
+    uint8_t irqPin;
+    int8_t irqSlot;
+    TMP11x_SampleCallback sampleCallback;
+
+    TMP11x_SampleSink *sinks;
+    uint32_t sampleTime;
+
+    /**
+     * Pass a fresh sample to all sinks.
+     */
+    void deliverSample(int16_t raw, uint32_t timestampMs);
+
+    static TMP11x_7Semi *irqOwners[TMP11X_MAX_IRQ_SENSORS];
+
+    /* ================= Interrupt Dispatch ================= */
+
+    /**
+     * ALERT pin ISR trampoline for one owner slot.
+     */
+    template <uint8_t SLOT>
+    static void isrSlot();
+
+    /**
+     * Attach an ALERT pin interrupt for this instance.
+     */
+    uint8_t attachAlertIrq(uint8_t pin, int edge);
 
     /* ================= Low-Level I2C ================= */
 
     /**
-     * Read 16-bit register (MSB first).
+     * Record a failure status and return false.
+     */
+    uint8_t fail(TMP11x_Status error);
+
+    /**
+     * Map a TwoWire endTransmission() code to TMP11x_Status.
+     */
+    static TMP11x_Status wireStatus(uint8_t code);
+
+    /**
+     * Initialize Wire with the stored pins and clock.
+     */
+    void initBus();
+
+    /**
+     * Select a device address and drop state of the previous one.
+     */
+    void selectDevice(uint8_t i2cAddress);
+
+    /**
+     * Read 16-bit register (MSB first), applying the retry policy.
      */
     uint8_t readReg(uint8_t reg, uint16_t &value);
 
     /**
-     * Write 16-bit register (MSB first).
+     * Write 16-bit register (MSB first), applying the retry policy.
      */
     uint8_t writeReg(uint8_t reg, uint16_t value);
 
+    /**
+     * Take / release the bus lock around one attempt.
+     */
+    uint8_t lockBus();
+    void unlockBus();
+
+    /**
+     * Check whether a read of reg must send the pointer first.
+     *
+     * - Only TEMP reads may reuse the cached pointer
+     */
+    bool needsPointer(uint8_t reg) const;
+
+    /**
+     * Single read attempt.
+     */
+    uint8_t readRegOnce(uint8_t reg, uint16_t &value);
+
+    /**
+     * Single write attempt.
+     */
+    uint8_t writeRegOnce(uint8_t reg, uint16_t value);
+
+    /**
+     * Decide whether a failed attempt is retried.
+     *
+     * - Applies backoff and optional bus recovery before returning true
+     */
+    bool retryAfterFailure(uint8_t attempt);
+
+    /* ================= Config Access ================= */
+
+    /**
+     * Get current CONFIG value.
+     *
+     * - Served from the shadow cache when enabled and valid
+     * - Otherwise reads the device
+     */
+    uint8_t loadConfig(uint16_t &config);
+
+    /**
+     * Replace the bits selected by mask and write CONFIG.
+     *
+     * - Single write when the cache is valid, read-modify-write otherwise
+     */
+    uint8_t updateConfig(uint16_t mask, uint16_t bits);
+
+    /**
+     * Store a CONFIG value in the shadow cache.
+     *
+     * - Keeps writable bits only
+     * - MOD is stored the way the device reads it back
+     */
+    void cacheConfig(uint16_t config);
+
+    /**
+     * Writable CONFIG bits as the device reads them back.
+     */
+    static uint16_t normalizeConfig(uint16_t config);
+
     /* ================= EEPROM Lock Control ================= */
 
     /**
@@ -394,6 +1482,60 @@ private:
      */
     uint8_t lockEEPROM();
 
+    /**
+     * Drop the EEPROM session after an error.
+     *
+     * - Re-locks EEPROM, keeps the original error in lastError()
+     */
+    uint8_t abortEEPROM();
+
+    /* ================= One-Shot Internals ================= */
+
+    /**
+     * Build the CONFIG word that triggers a one-shot.
+     *
+     * - No bus traffic when the config cache is valid
+     * - Records the expected conversion time for triggerOneShot()
+     */
+    uint8_t prepareOneShot(uint16_t &word);
+
+    /**
+     * Write a prepared one-shot word and start the state machine.
+     */
+    uint8_t triggerOneShot(uint16_t word);
+
+    /* ================= Queued Transactions ================= */
+
+    /**
+     * Side effects of a register read completed by the transaction queue.
+     *
+     * - CONFIG: collects status flags, refreshes the config cache
+     * - TEMP: applies calibration to value, consumes Data_Ready
+     */
+    void completeRead(uint8_t reg, uint16_t &value);
+
+    /**
+     * Side effects of a completed queued register write.
+     *
+     * - CONFIG: updates the config cache; a one-shot word starts the
+     *   one-shot state machine, soft reset invalidates the cache
+     */
+    void completeWrite(uint8_t reg, uint16_t value);
+
+    /**
+     * Deliver a queued temperature read as a sample.
+     */
+    void completeSample(int16_t raw);
+
+    /**
+     * Drop cached state after a failed queued transaction.
+     */
+    void abortTransaction(uint8_t reg, bool write);
+
+    friend class TMP11x_Bus;
+    friend class TMP11x_AlertWindow;
+    friend class TMP11x_TransactionQueue;
+
     /* ================= Helpers ================= */
 
     /**
@@ -405,6 +1547,8 @@ private:
 
     /**
      * Convert Celsius to raw temperature code.
+     *
+     * - Rounded to nearest and clamped to the register range
      */
     int16_t celsiusToRaw(float temp);
 };
@@ -0,0 +1,144 @@
+/**
+ * 7Semi TMP11x Adaptive Sampling
+ *
+ * - slow: switch when the wake window trips or |slope| >= enter
+ * - fast: switch back after dwellMs in fast and dwellMs of |slope| < exit
+ */
+
+#include "7Semi_TMP11x_Adaptive.h"
+
+/* Wake window flags delivered with samples */
+#define ADAPTIVE_WAKE_FLAGS (TMP11X_CFG_HIGH_ALERT | TMP11X_CFG_LOW_ALERT)
+
+TMP11x_Adaptive::TMP11x_Adaptive(TMP11x_7Semi &tmp, const TMP11x_AdaptiveSettings &settings)
+    : slope(settings.slopeShift) {
+    sensor = &tmp;
+    cfg = settings;
+    fast = false;
+    windowArmed = false;
+    fastSince = 0;
+    calmSince = 0;
+    switches = 0;
+}
+
+/**
+ * Start in slow mode.
+ */
+uint8_t TMP11x_Adaptive::begin() {
+    fast = false;
+    windowArmed = false;
+    slope.resetStats();
+
+    if (!sensor->isConfigCacheEnabled() && !sensor->enableConfigCache())
+        return false;
+
+    if (!sensor->setThermAlertMode(ALERT_MODE) ||
+        !sensor->setMode(CONTINUOUS_0))
+        return false;
+
+    return sensor->setConversionTiming(cfg.slowConv, cfg.slowAvg);
+}
+
+/**
+ * Replace the settings.
+ */
+void TMP11x_Adaptive::setSettings(const TMP11x_AdaptiveSettings &settings) {
+    cfg = settings;
+    slope.setEmaShift(settings.slopeShift);
+}
+
+/**
+ * Sample sink entry point.
+ */
+void TMP11x_Adaptive::onSample(int16_t rawTemperature, uint32_t timestampMs, uint16_t flags) {
+    slope.add(rawTemperature, timestampMs);
+
+    int32_t s = slope.slopeMilliCPerS();
+    uint32_t magnitude = (uint32_t)(s < 0 ? -s : s);
+
+    if (!fast) {
+        bool wake = windowArmed && (flags & ADAPTIVE_WAKE_FLAGS);
+
+        if (wake || (slope.count() > 2 && magnitude >= cfg.enterSlopeMilliCPerS))
+            goFast(timestampMs);
+        else if (!windowArmed)
+            armWindow(rawTemperature);
+        return;
+    }
+
+    if (magnitude >= cfg.exitSlopeMilliCPerS)
+        calmSince = timestampMs;
+
+    if (timestampMs - fastSince >= cfg.dwellMs && timestampMs - calmSince >= cfg.dwellMs)
+        goSlow(rawTemperature);
+}
+
+/**
+ * True while the fast setting is active.
+ */
+bool TMP11x_Adaptive::isFast() const {
+    return fast;
+}
+
+/**
+ * Number of slow <-> fast switches.
+ */
+uint32_t TMP11x_Adaptive::switchCount() const {
+    return switches;
+}
+
+/**
+ * Slope / statistics engine.
+ */
+const TMP11x_Stats &TMP11x_Adaptive::stats() const {
+    return slope;
+}
+
+/**
+ * Switch to the fast setting.
+ *
+ * - The wake window is left in place; its flags are ignored while fast
+ */
+void TMP11x_Adaptive::goFast(uint32_t timestampMs) {
+    if (!sensor->setConversionTiming(cfg.fastConv, cfg.fastAvg))
+        return;
+
+    fast = true;
+    windowArmed = false;
+    fastSince = timestampMs;
+    calmSince = timestampMs;
+    switches++;
+}
+
+/**
+ * Switch to the slow setting and re-center the wake window.
+ */
+void TMP11x_Adaptive::goSlow(int16_t rawTemperature) {
+    if (!sensor->setConversionTiming(cfg.slowConv, cfg.slowAvg))
+        return;
+
+    fast = false;
+    switches++;
+    armWindow(rawTemperature);
+}
+
+/**
+ * Place the wake window around a value.
+ *
+ * - Two limit writes; flags latched before this are dropped
+ */
+void TMP11x_Adaptive::armWindow(int16_t rawTemperature) {
+    if (!cfg.wakeBandMilliC) {
+        windowArmed = false;
+        return;
+    }
+
+    int32_t center = TMP11x_rawToMilliC(rawTemperature);
+    if (!sensor->setHighLimitMilliC(center + cfg.wakeBandMilliC) ||
+        !sensor->setLowLimitMilliC(center - cfg.wakeBandMilliC))
+        return;
+
+    uint16_t stale;
+    sensor->readStatusFlags(stale);
+    windowArmed = true;
+}
@@ -0,0 +1,138 @@
+/**
+ * 7Semi TMP11x Adaptive Sampling
+ *
+ * - Runs a continuous-mode sensor at a slow, low-power CONV / AVG while
+ *   the temperature is flat
+ * - Switches to a fast CONV / AVG while it is changing
+ * - Decision inputs:
+ *   - Slope from the built-in TMP11x_Stats engine
+ *   - Wake window: T_HIGH / T_LOW placed around the last slow-mode value;
+ *     the first conversion outside it switches to fast immediately
+ * - Rate changes use setConversionTiming() (one CONFIG write with the cache)
+ *
+ * Usage:
+ * - sensor.begin(), adaptive.begin(), sensor.addSampleSink(adaptive)
+ * - Call sensor.service() (or readTemperatureIfReady()) from loop()
+ *
+ * Notes:
+ * - Owns T_HIGH / T_LOW and sets ALERT mode; do not combine with
+ *   TMP11x_AlertWindow on the same sensor
+ * - Rate changes are issued from onSample() (loop context, never an ISR)
+ */
+
+#ifndef _7SEMI_TMP11X_ADAPTIVE_H_
+#define _7SEMI_TMP11X_ADAPTIVE_H_
+
+#include "7Semi_TMP11x.h"
+#include "7Semi_TMP11x_Stats.h"
+
+/**
+ * Adaptive sampling settings.
+ *
+ * - slowConv / slowAvg: flat-temperature setting
+ * - fastConv / fastAvg: changing-temperature setting
+ * - enterSlopeMilliCPerS: |slope| that switches to fast
+ * - exitSlopeMilliCPerS: |slope| below which fast may end
+ * - dwellMs: minimum time in fast mode, and how long the slope must stay
+ *   below exit before returning to slow
+ * - wakeBandMilliC: half-width of the slow-mode wake window (0 = off)
+ * - slopeShift: slope smoothing (alpha = 1 / 2^shift)
+ */
+struct TMP11x_AdaptiveSettings {
+    TMP11x_CONV slowConv;
+    TMP11x_AVG slowAvg;
+    TMP11x_CONV fastConv;
+    TMP11x_AVG fastAvg;
+    uint16_t enterSlopeMilliCPerS;
+    uint16_t exitSlopeMilliCPerS;
+    uint32_t dwellMs;
+    uint16_t wakeBandMilliC;
+    uint8_t slopeShift;
+
+    constexpr TMP11x_AdaptiveSettings(TMP11x_CONV slowC = CONV_4S,
+                                      TMP11x_AVG slowA = AVG_8,
+                                      TMP11x_CONV fastC = CONV_125MS,
+                                      TMP11x_AVG fastA = AVG_8,
+                                      uint16_t enter = 50,
+                                      uint16_t exit = 20,
+                                      uint32_t dwell = 5000,
+                                      uint16_t band = 250,
+                                      uint8_t shift = 2)
+        : slowConv(slowC), slowAvg(slowA), fastConv(fastC), fastAvg(fastA),
+          enterSlopeMilliCPerS(enter), exitSlopeMilliCPerS(exit), dwellMs(dwell),
+          wakeBandMilliC(band), slopeShift(shift) {}
+};
+
+/* ================= TMP11x Adaptive Class ================= */
+
+class TMP11x_Adaptive : public TMP11x_SampleSink {
+public:
+    /**
+     * Constructor.
+     *
+     * - sensor: initialized sensor (begin() / attach() done)
+     */
+    TMP11x_Adaptive(TMP11x_7Semi &sensor,
+                    const TMP11x_AdaptiveSettings &settings = TMP11x_AdaptiveSettings());
+
+    /**
+     * Start in slow mode.
+     *
+     * - Enables the config cache, selects continuous mode + ALERT mode
+     * - Wake window is placed at the first sample
+     */
+    uint8_t begin();
+
+    /**
+     * Replace the settings (takes effect at the next decision).
+     */
+    void setSettings(const TMP11x_AdaptiveSettings &settings);
+
+    /**
+     * Sample sink entry point: update slope, switch rate if needed.
+     */
+    virtual void onSample(int16_t rawTemperature, uint32_t timestampMs, uint16_t flags);
+
+    /**
+     * True while the fast setting is active.
+     */
+    bool isFast() const;
+
+    /**
+     * Number of slow <-> fast switches.
+     */
+    uint32_t switchCount() const;
+
+    /**
+     * Slope / statistics engine used for decisions.
+     */
+    const TMP11x_Stats &stats() const;
+
+private:
+    TMP11x_7Semi *sensor;
+    TMP11x_AdaptiveSettings cfg;
+    TMP11x_Stats slope;
+
+    bool fast;
+    bool windowArmed;
+    uint32_t fastSince;
+    uint32_t calmSince;
+    uint32_t switches;
+
+    /**
+     * Switch to the fast setting.
+     */
+    void goFast(uint32_t timestampMs);
+
+    /**
+     * Switch to the slow setting.
+     */
+    void goSlow(int16_t rawTemperature);
+
+    /**
+     * Place the wake window around a value.
+     */
+    void armWindow(int16_t rawTemperature);
+};
+
+#endif
@@ -0,0 +1,230 @@
+/**
+ * 7Semi TMP11x Alert Window Engine
+ *
+ * - Thermostat: state follows HIGH_Alert (not cleared by reads in THERM mode)
+ * - Window: state machine driven by latched HIGH_Alert / LOW_Alert
+ */
+
+#include "7Semi_TMP11x_Alert.h"
+
+/* Limit value that can never trip */
+#define ALERT_LIMIT_OFF_HIGH  ((int16_t)0x7FFF)
+#define ALERT_LIMIT_OFF_LOW   ((int16_t)0x8000)
+
+TMP11x_AlertWindow::TMP11x_AlertWindow(TMP11x_7Semi &tmp) {
+    sensor = &tmp;
+    thermostat = false;
+    armed = false;
+    evaluate = false;
+    lowRaw = ALERT_LIMIT_OFF_LOW;
+    highRaw = ALERT_LIMIT_OFF_HIGH;
+    hysteresisRaw = 0;
+    current = ALERT_STATE_CLEAR;
+    highCallback = NULL;
+    lowCallback = NULL;
+    clearCallback = NULL;
+}
+
+/* ================= Setup ================= */
+
+/**
+ * Arm thermostat mode.
+ *
+ * - The device holds the hysteresis band between T_LOW and T_HIGH
+ */
+uint8_t TMP11x_AlertWindow::beginThermostat(uint8_t pin, int32_t highMilliC, int32_t hysteresisMilliC) {
+    if (hysteresisMilliC < 0)
+        return sensor->fail(TMP11X_ERR_INVALID_ARG);
+
+    thermostat = true;
+    highRaw = TMP11x_milliCToRaw(highMilliC);
+    hysteresisRaw = TMP11x_milliCToRaw(hysteresisMilliC);
+    lowRaw = TMP11x_clampRaw((int32_t)highRaw - hysteresisRaw);
+
+    if (!sensor->writeReg(REG_T_HIGH, (uint16_t)highRaw) ||
+        !sensor->writeReg(REG_T_LOW, (uint16_t)lowRaw))
+        return false;
+
+    return arm(pin, THERM_MODE);
+}
+
+/**
+ * Arm window mode.
+ */
+uint8_t TMP11x_AlertWindow::beginWindow(uint8_t pin, int32_t lowMilliC, int32_t highMilliC, int32_t hysteresisMilliC) {
+    if (hysteresisMilliC < 0 || lowMilliC + hysteresisMilliC >= highMilliC - hysteresisMilliC)
+        return sensor->fail(TMP11X_ERR_INVALID_ARG);
+
+    thermostat = false;
+    lowRaw = TMP11x_milliCToRaw(lowMilliC);
+    highRaw = TMP11x_milliCToRaw(highMilliC);
+    hysteresisRaw = TMP11x_milliCToRaw(hysteresisMilliC);
+
+    if (!program(ALERT_STATE_CLEAR))
+        return false;
+
+    return arm(pin, ALERT_MODE);
+}
+
+/**
+ * Common setup.
+ *
+ * - Reads CONFIG once (readStatusFlags()) to drop stale flags before
+ *   the interrupt is live, so they are neither latched nor forwarded
+ *   with the next sample
+ * - THERM: ALERT level follows the state, so both edges are caught
+ * - ALERT: pin asserts per event and releases on the CONFIG read
+ */
+uint8_t TMP11x_AlertWindow::arm(uint8_t pin, TMP11x_THERM_ALERT mode) {
+    uint8_t activeHigh;
+    uint16_t stale;
+
+    if (!sensor->setThermAlertMode(mode) ||
+        !sensor->setAlertPinFunction(ALERT_PIN_ALERT) ||
+        !sensor->getAlertPolarity(activeHigh) ||
+        !sensor->readStatusFlags(stale))
+        return false;
+
+    int edge = thermostat ? CHANGE : (activeHigh ? RISING : FALLING);
+    if (!sensor->attachAlertIrq(pin, edge))
+        return false;
+
+    current = ALERT_STATE_CLEAR;
+    armed = true;
+
+    /* THERM state may already be active; check once in service() */
+    evaluate = thermostat;
+    return true;
+}
+
+/**
+ * Detach the interrupt.
+ */
+void TMP11x_AlertWindow::end() {
+    if (!armed)
+        return;
+
+    sensor->detachDataReadyInterrupt();
+    armed = false;
+    evaluate = false;
+}
+
+/* ================= Callbacks ================= */
+
+void TMP11x_AlertWindow::onHigh(TMP11x_AlertCallback callback) {
+    highCallback = callback;
+}
+
+void TMP11x_AlertWindow::onLow(TMP11x_AlertCallback callback) {
+    lowCallback = callback;
+}
+
+void TMP11x_AlertWindow::onClear(TMP11x_AlertCallback callback) {
+    clearCallback = callback;
+}
+
+/* ================= Service ================= */
+
+/**
+ * Handle a pending ALERT edge.
+ */
+uint8_t TMP11x_AlertWindow::service() {
+    if (!armed || (!sensor->irqPending && !evaluate))
+        return sensor->fail(TMP11X_ERR_NOT_READY);
+
+    noInterrupts();
+    uint32_t timestamp = sensor->irqPending ? sensor->irqTime : millis();
+    sensor->irqPending = false;
+    interrupts();
+    evaluate = false;
+
+    uint16_t cfg;
+    if (!sensor->readConfig(cfg))
+        return false;
+
+    bool high = (cfg & TMP11X_CFG_HIGH_ALERT) != 0;
+    bool low = (cfg & TMP11X_CFG_LOW_ALERT) != 0;
+
+    /* Consumed here; keep them out of readStatusFlags() */
+    sensor->statusFlags &= ~(TMP11X_CFG_HIGH_ALERT | TMP11X_CFG_LOW_ALERT);
+
+    TMP11x_ALERT_STATE next = current;
+    if (thermostat) {
+        next = high ? ALERT_STATE_HIGH : ALERT_STATE_CLEAR;
+    } else {
+        switch (current) {
+        case ALERT_STATE_CLEAR:
+            if (high)
+                next = ALERT_STATE_HIGH;
+            else if (low)
+                next = ALERT_STATE_LOW;
+            break;
+        case ALERT_STATE_HIGH:
+            if (low)
+                next = ALERT_STATE_CLEAR;
+            break;
+        default:
+            if (high)
+                next = ALERT_STATE_CLEAR;
+            break;
+        }
+    }
+
+    if (next == current)
+        return true;
+
+    if (!thermostat && !program(next))
+        return false;
+
+    current = next;
+
+    TMP11x_AlertCallback callback;
+    switch (next) {
+    case ALERT_STATE_HIGH:
+        callback = highCallback;
+        break;
+    case ALERT_STATE_LOW:
+        callback = lowCallback;
+        break;
+    default:
+        callback = clearCallback;
+        break;
+    }
+
+    if (callback)
+        callback(timestamp);
+    return true;
+}
+
+/**
+ * Current alert state.
+ */
+TMP11x_ALERT_STATE TMP11x_AlertWindow::state() const {
+    return current;
+}
+
+/**
+ * Write the limits for a window-mode state.
+ */
+uint8_t TMP11x_AlertWindow::program(TMP11x_ALERT_STATE next) {
+    int16_t high;
+    int16_t low;
+
+    switch (next) {
+    case ALERT_STATE_HIGH:
+        high = ALERT_LIMIT_OFF_HIGH;
+        low = TMP11x_clampRaw((int32_t)highRaw - hysteresisRaw);
+        break;
+    case ALERT_STATE_LOW:
+        high = TMP11x_clampRaw((int32_t)lowRaw + hysteresisRaw);
+        low = ALERT_LIMIT_OFF_LOW;
+        break;
+    default:
+        high = highRaw;
+        low = lowRaw;
+        break;
+    }
+
+    return sensor->writeReg(REG_T_HIGH, (uint16_t)high) &&
+           sensor->writeReg(REG_T_LOW, (uint16_t)low);
+}
@@ -0,0 +1,126 @@
+/**
+ * 7Semi TMP11x Alert Window Engine
+ *
+ * - Programs T_HIGH / T_LOW with software-defined hysteresis
+ * - ALERT edge caught by MCU interrupt; ISR only timestamps
+ * - service() reads CONFIG once (gets and clears both flags) and
+ *   dispatches onHigh / onLow / onClear
+ *
+ * Modes:
+ * - Thermostat: THERM mode, one upper limit
+ *   - T_HIGH = high, T_LOW = high - hysteresis
+ *   - Device applies the hysteresis itself; ALERT follows the state
+ * - Window: ALERT mode, low and high limits
+ *   - Device flags are latched per conversion, so hysteresis is applied
+ *     by moving the limits after each event:
+ *     - clear: T_HIGH = high, T_LOW = low
+ *     - high:  T_HIGH = off,  T_LOW = high - hysteresis
+ *     - low:   T_HIGH = low + hysteresis, T_LOW = off
+ *
+ * Notes:
+ * - Uses the sensor's ALERT interrupt slot; not combinable with
+ *   attachDataReadyInterrupt() (the pin has one function)
+ * - Do not call sensor.service() while the engine is active
+ */
+
+#ifndef _7SEMI_TMP11X_ALERT_H_
+#define _7SEMI_TMP11X_ALERT_H_
+
+#include "7Semi_TMP11x.h"
+
+/**
+ * Alert state seen by the engine.
+ */
+typedef enum {
+    ALERT_STATE_CLEAR = 0,
+    ALERT_STATE_HIGH  = 1,
+    ALERT_STATE_LOW   = 2
+} TMP11x_ALERT_STATE;
+
+/**
+ * Alert event callback.
+ *
+ * - timestampMs: millis() at the ALERT edge
+ */
+typedef void (*TMP11x_AlertCallback)(uint32_t timestampMs);
+
+/* ================= TMP11x Alert Window ================= */
+
+class TMP11x_AlertWindow {
+public:
+    /**
+     * Constructor.
+     *
+     * - sensor: initialized sensor (begin() / attach() done)
+     */
+    TMP11x_AlertWindow(TMP11x_7Semi &sensor);
+
+    /**
+     * Arm thermostat mode (THERM, upper limit with hysteresis).
+     *
+     * - pin: MCU interrupt pin wired to ALERT (pulled up)
+     * - Fires onHigh above highMilliC, onClear below highMilliC - hysteresisMilliC
+     */
+    uint8_t beginThermostat(uint8_t pin, int32_t highMilliC, int32_t hysteresisMilliC);
+
+    /**
+     * Arm window mode (ALERT, low and high limits with hysteresis).
+     *
+     * - Fires onHigh above highMilliC, onLow below lowMilliC
+     * - Fires onClear once back inside the window by hysteresisMilliC
+     * - Requires lowMilliC + hysteresisMilliC < highMilliC - hysteresisMilliC
+     */
+    uint8_t beginWindow(uint8_t pin, int32_t lowMilliC, int32_t highMilliC, int32_t hysteresisMilliC);
+
+    /**
+     * Detach the interrupt (device limits stay programmed).
+     */
+    void end();
+
+    /**
+     * Event callbacks (NULL to disable).
+     */
+    void onHigh(TMP11x_AlertCallback callback);
+    void onLow(TMP11x_AlertCallback callback);
+    void onClear(TMP11x_AlertCallback callback);
+
+    /**
+     * Handle a pending ALERT edge; call from loop().
+     *
+     * - No edge pending: returns false with TMP11X_ERR_NOT_READY, no bus traffic
+     * - Edge pending: one CONFIG read, limit writes only on a state change
+     */
+    uint8_t service();
+
+    /**
+     * Current alert state.
+     */
+    TMP11x_ALERT_STATE state() const;
+
+private:
+    TMP11x_7Semi *sensor;
+
+    bool thermostat;
+    bool armed;
+    bool evaluate;
+    int16_t lowRaw;
+    int16_t highRaw;
+    int16_t hysteresisRaw;
+    TMP11x_ALERT_STATE current;
+
+    TMP11x_AlertCallback highCallback;
+    TMP11x_AlertCallback lowCallback;
+    TMP11x_AlertCallback clearCallback;
+
+    /**
+     * Common setup: thresholds, mode, pin function, interrupt.
+     */
+    uint8_t arm(uint8_t pin, TMP11x_THERM_ALERT mode);
+
+    /**
+     * Write the limits for a window-mode state.
+     */
+    uint8_t program(TMP11x_ALERT_STATE next);
+};
+
+#endif
@@ -0,0 +1,258 @@
+/**
+ * 7Semi TMP11x Bus Manager
+ *
+ * - Groups up to four TMP11x sensors on one TwoWire
+ * - Sensors share a single bus initialization
+ */
+
+#include "7Semi_TMP11x_Bus.h"
+
+TMP11x_Bus::TMP11x_Bus(TwoWire &wirePort)
+    : i2c(&wirePort),
+      sensors{TMP11x_7Semi(wirePort), TMP11x_7Semi(wirePort),
+              TMP11x_7Semi(wirePort), TMP11x_7Semi(wirePort)} {
+    sensorCount = 0;
+    readyMask = 0;
+    pendingMask = 0;
+    skewUs = 0;
+    for (uint8_t i = 0; i < TMP11X_BUS_MAX_SENSORS; i++)
+        captureUs[i] = 0;
+}
+
+/* ================= Initialization ================= */
+
+/**
+ * Initialize the bus once and probe every address strap.
+ *
+ * - Found sensors are packed to the front of the list
+ */
+uint8_t TMP11x_Bus::begin(uint8_t sda, uint8_t scl, uint32_t i2cClockSpeed) {
+    sensorCount = 0;
+    readyMask = 0;
+    pendingMask = 0;
+
+    /**
+     * Every slot keeps the pins and clock for recoverBus();
+     * Wire is initialized by the first probe only
+     */
+    bool initializeBus = true;
+    for (uint8_t i = 0; i < TMP11X_BUS_MAX_SENSORS; i++) {
+        TMP11x_7Semi &s = sensors[sensorCount];
+        bool found = s.begin(TMP11X_BUS_BASE_ADDRESS + i, sda, scl, i2cClockSpeed, initializeBus);
+        initializeBus = false;
+        if (!found)
+            continue;
+
+        s.enableConfigCache();
+        sensorCount++;
+    }
+
+    return sensorCount;
+}
+
+/**
+ * Number of sensors found by begin().
+ */
+uint8_t TMP11x_Bus::count() const {
+    return sensorCount;
+}
+
+/**
+ * Access a sensor by index.
+ *
+ * - Checked against sensorCount, not the slot array size
+ */
+uint8_t TMP11x_Bus::sensor(uint8_t index, TMP11x_7Semi *&s) {
+    if (index >= sensorCount)
+        return false;
+    s = &sensors[index];
+    return true;
+}
+
+/**
+ * I2C address of a sensor by index.
+ */
+uint8_t TMP11x_Bus::address(uint8_t index) const {
+    if (index >= sensorCount)
+        return 0;
+    return sensors[index].getAddress();
+}
+
+/**
+ * Share one bus lock between all sensor slots.
+ */
+void TMP11x_Bus::setBusLock(TMP11x_BusLock *lock, uint32_t timeoutMs) {
+    for (uint8_t i = 0; i < TMP11X_BUS_MAX_SENSORS; i++)
+        sensors[i].setBusLock(lock, timeoutMs);
+}
+
+/* ================= Group Operations ================= */
+
+/**
+ * Apply one configuration to every sensor.
+ */
+uint8_t TMP11x_Bus::configureAll(const TMP11x_Config &cfg) {
+    uint8_t ok = true;
+    for (uint8_t i = 0; i < sensorCount; i++) {
+        if (!sensors[i].configure(cfg))
+            ok = false;
+    }
+    return ok;
+}
+
+/**
+ * Trigger one-shots back to back.
+ *
+ * - Conversions run in parallel, so a full scan takes about one
+ *   conversion time instead of count() times that
+ */
+uint8_t TMP11x_Bus::startOneShotAll() {
+    uint8_t ok = true;
+
+    readyMask = 0;
+    pendingMask = 0;
+
+    for (uint8_t i = 0; i < sensorCount; i++) {
+        if (sensors[i].startOneShot()) {
+            captureUs[i] = micros();
+            pendingMask |= (1 << i);
+        } else {
+            ok = false;
+        }
+    }
+
+    updateSkew();
+    return ok;
+}
+
+/**
+ * Trigger a synchronized one-shot on every sensor.
+ *
+ * - Preparation happens before the timed loop, so only the
+ *   CONFIG writes themselves separate the sensors
+ */
+uint8_t TMP11x_Bus::startOneShotSynchronized() {
+    uint16_t words[TMP11X_BUS_MAX_SENSORS];
+    uint8_t preparedMask = 0;
+    uint8_t ok = true;
+
+    readyMask = 0;
+    pendingMask = 0;
+
+    for (uint8_t i = 0; i < sensorCount; i++) {
+        if (sensors[i].prepareOneShot(words[i]))
+            preparedMask |= (1 << i);
+        else
+            ok = false;
+    }
+
+    for (uint8_t i = 0; i < sensorCount; i++) {
+        if (!(preparedMask & (1 << i)))
+            continue;
+
+        if (sensors[i].triggerOneShot(words[i])) {
+            captureUs[i] = micros();
+            pendingMask |= (1 << i);
+        } else {
+            ok = false;
+        }
+    }
+
+    updateSkew();
+    return ok;
+}
+
+/**
+ * Capture timestamp of a sensor's last trigger.
+ */
+uint32_t TMP11x_Bus::captureTime(uint8_t index) const {
+    if (index >= sensorCount)
+        return 0;
+    return captureUs[index];
+}
+
+/**
+ * Worst-case skew between capture timestamps.
+ */
+uint32_t TMP11x_Bus::lastSkewUs() const {
+    return skewUs;
+}
+
+/**
+ * Compute skew relative to the first triggered sensor.
+ *
+ * - Wrap-safe: offsets are taken from the first capture
+ */
+void TMP11x_Bus::updateSkew() {
+    bool first = true;
+    uint32_t base = 0;
+    uint32_t span = 0;
+
+    for (uint8_t i = 0; i < sensorCount; i++) {
+        if (!(pendingMask & (1 << i)))
+            continue;
+
+        if (first) {
+            base = captureUs[i];
+            first = false;
+            continue;
+        }
+
+        uint32_t offset = captureUs[i] - base;
+        if (offset > span)
+            span = offset;
+    }
+
+    skewUs = span;
+}
+
+/**
+ * Collect results as each sensor becomes ready.
+ */
+bool TMP11x_Bus::poll() {
+    for (uint8_t i = 0; i < sensorCount; i++) {
+        if (!(pendingMask & (1 << i)))
+            continue;
+
+        if (!sensors[i].poll())
+            continue;
+
+        if (sensors[i].fetchRaw(results[i]))
+            readyMask |= (1 << i);
+        pendingMask &= ~(1 << i);
+    }
+
+    return pendingMask == 0;
+}
+
+/**
+ * Check whether a sensor has a result.
+ */
+bool TMP11x_Bus::isReady(uint8_t index) const {
+    if (index >= sensorCount)
+        return false;
+    return (readyMask & (1 << index)) != 0;
+}
+
+/**
+ * Get collected result (raw code).
+ */
+uint8_t TMP11x_Bus::getRaw(uint8_t index, int16_t &rawTemperature) const {
+    if (!isReady(index))
+        return false;
+    rawTemperature = results[index];
+    return true;
+}
+
+/**
+ * Get collected result in Celsius.
+ *
+ * - 1 LSB = 0.0078125 °C
+ */
+uint8_t TMP11x_Bus::getTemperatureC(uint8_t index, float &temperatureC) const {
+    int16_t raw;
+    if (!getRaw(index, raw))
+        return false;
+    temperatureC = raw * 0.0078125f;
+    return true;
+}
@@ -0,0 +1,172 @@
+/**
+ * 7Semi TMP11x Bus Manager
+ *
+ * - Manages up to four TMP116/TMP117 on one TwoWire (0x48..0x4B)
+ * - Initializes the bus once and probes all addresses in one pass
+ * - Applies one shared configuration to every sensor
+ * - Triggers one-shots back to back so conversion windows overlap
+ * - Synchronized capture with per-sensor timestamps and skew report
+ *
+ * Typical usage:
+ * - begin()
+ * - configureAll(cfg)
+ * - startOneShotAll(), then poll() from loop() until it returns true
+ */
+
+#ifndef _7SEMI_TMP11X_BUS_H_
+#define _7SEMI_TMP11X_BUS_H_
+
+#include "7Semi_TMP11x.h"
+
+/**
+ * Number of address straps (0x48..0x4B).
+ */
+#define TMP11X_BUS_MAX_SENSORS 4
+
+/**
+ * First address in the TMP11x address range.
+ */
+#define TMP11X_BUS_BASE_ADDRESS 0x48
+
+/* ================= TMP11x Bus Class ================= */
+
+class TMP11x_Bus {
+public:
+    /**
+     * Constructor.
+     *
+     * - wirePort: I2C port instance shared by all sensors
+     */
+    TMP11x_Bus(TwoWire &wirePort = Wire);
+
+    /**
+     * Initialize the bus once and probe 0x48..0x4B.
+     *
+     * - sda/scl:
+     *   - ESP32/ESP8266 only: specify custom pins
+     *   - Use 0xFF to keep default pins
+     * - i2cClockSpeed: I2C bus speed in Hz (default 400000)
+     * - Config cache is enabled on every sensor found
+     *
+     * - Returns:
+     *   - number of sensors found
+     */
+    uint8_t begin(uint8_t sda = 0xFF,
+                  uint8_t scl = 0xFF,
+                  uint32_t i2cClockSpeed = 400000);
+
+    /**
+     * Number of sensors found by begin().
+     */
+    uint8_t count() const;
+
+    /**
+     * Access a sensor by index (0..count()-1).
+     *
+     * - Sensors are ordered by address
+     * - index >= count() leaves s untouched; unprobed slots are never
+     *   handed out
+     *
+     * Returns:
+     *   - true if index selects a probed sensor
+     */
+    uint8_t sensor(uint8_t index, TMP11x_7Semi *&s);
+
+    /**
+     * I2C address of a sensor by index.
+     *
+     * - Returns 0 when index >= count()
+     */
+    uint8_t address(uint8_t index) const;
+
+    /**
+     * Share one bus lock between all sensor slots.
+     *
+     * - Call before begin() so probing is locked too
+     * - See TMP11x_7Semi::setBusLock()
+     */
+    void setBusLock(TMP11x_BusLock *lock, uint32_t timeoutMs = 100);
+
+    /* ================= Group Operations ================= */
+
+    /**
+     * Apply one configuration to every sensor.
+     *
+     * - One CONFIG write per sensor
+     * - Returns true only if all writes succeed
+     */
+    uint8_t configureAll(const TMP11x_Config &cfg);
+
+    /**
+     * Trigger a one-shot on every sensor, back to back.
+     *
+     * - Clears previous results
+     * - Returns true only if every trigger succeeds
+     */
+    uint8_t startOneShotAll();
+
+    /**
+     * Trigger a synchronized one-shot on every sensor.
+     *
+     * - All CONFIG words are built first (from the config cache)
+     * - Then written in a tight back-to-back loop
+     * - TMP11x general call only supports reset, so triggers are addressed
+     * - Each trigger's completion time is recorded as the capture time
+     * - Returns true only if every trigger succeeds
+     */
+    uint8_t startOneShotSynchronized();
+
+    /**
+     * Capture timestamp (micros()) of a sensor's last trigger.
+     */
+    uint32_t captureTime(uint8_t index) const;
+
+    /**
+     * Worst-case skew between capture timestamps in microseconds.
+     *
+     * - Measured over sensors triggered by the last start call
+     */
+    uint32_t lastSkewUs() const;
+
+    /**
+     * Collect one-shot results as each sensor becomes ready.
+     *
+     * - Non-blocking; call repeatedly from loop()
+     * - Returns true once every triggered sensor has a result
+     */
+    bool poll();
+
+    /**
+     * Check whether a sensor has a result from the last startOneShotAll().
+     */
+    bool isReady(uint8_t index) const;
+
+    /**
+     * Get collected result (raw code).
+     */
+    uint8_t getRaw(uint8_t index, int16_t &rawTemperature) const;
+
+    /**
+     * Get collected result in Celsius.
+     */
+    uint8_t getTemperatureC(uint8_t index, float &temperatureC) const;
+
+private:
+    TwoWire *i2c;
+    TMP11x_7Semi sensors[TMP11X_BUS_MAX_SENSORS];
+    uint8_t sensorCount;
+
+    int16_t results[TMP11X_BUS_MAX_SENSORS];
+    uint8_t readyMask;
+    uint8_t pendingMask;
+
+    uint32_t captureUs[TMP11X_BUS_MAX_SENSORS];
+    uint32_t skewUs;
+
+    /**
+     * Update skewUs from captureUs of triggered sensors.
+     */
+    void updateSkew();
+};
+
+#endif
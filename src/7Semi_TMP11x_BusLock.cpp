@@ -0,0 +1,96 @@
+/**
+ * 7Semi TMP11x Bus Lock
+ *
+ * - Contention accounting in the base class
+ * - Platform mutexes in subclasses
+ */
+
+#include "7Semi_TMP11x_BusLock.h"
+
+TMP11x_BusLock::TMP11x_BusLock() {
+    resetStats();
+}
+
+/**
+ * Take the bus.
+ *
+ * - Fast path: tryLock() succeeds, no clock read
+ * - Slow path: timed lock(), wait time recorded once the lock is held
+ */
+bool TMP11x_BusLock::acquire(uint32_t timeoutMs) {
+    if (tryLock()) {
+        lockStats.acquisitions++;
+        return true;
+    }
+
+    uint32_t start = micros();
+    if (!lock(timeoutMs)) {
+        lockStats.timeouts++;
+        return false;
+    }
+
+    uint32_t waited = micros() - start;
+    lockStats.acquisitions++;
+    lockStats.contended++;
+    lockStats.totalWaitUs += waited;
+    if (waited > lockStats.maxWaitUs)
+        lockStats.maxWaitUs = waited;
+    return true;
+}
+
+/**
+ * Release the bus.
+ */
+void TMP11x_BusLock::release() {
+    unlock();
+}
+
+/**
+ * Contention counters.
+ */
+const TMP11x_BusLockStats &TMP11x_BusLock::stats() const {
+    return lockStats;
+}
+
+/**
+ * Clear contention counters.
+ */
+void TMP11x_BusLock::resetStats() {
+    lockStats.acquisitions = 0;
+    lockStats.contended = 0;
+    lockStats.timeouts = 0;
+    lockStats.totalWaitUs = 0;
+    lockStats.maxWaitUs = 0;
+}
+
+/**
+ * Mean wait of contended acquisitions (us).
+ */
+uint32_t TMP11x_BusLock::averageWaitUs() const {
+    if (!lockStats.contended)
+        return 0;
+    return lockStats.totalWaitUs / lockStats.contended;
+}
+
+#if defined(ESP32)
+
+/* ================= FreeRTOS Mutex Lock ================= */
+
+TMP11x_FreeRTOSBusLock::TMP11x_FreeRTOSBusLock() {
+    mutex = xSemaphoreCreateMutexStatic(&mutexBuffer);
+}
+
+bool TMP11x_FreeRTOSBusLock::tryLock() {
+    return xSemaphoreTake(mutex, 0) == pdTRUE;
+}
+
+bool TMP11x_FreeRTOSBusLock::lock(uint32_t timeoutMs) {
+    TickType_t ticks = timeoutMs == 0xFFFFFFFFUL ? portMAX_DELAY : pdMS_TO_TICKS(timeoutMs);
+    return xSemaphoreTake(mutex, ticks) == pdTRUE;
+}
+
+void TMP11x_FreeRTOSBusLock::unlock() {
+    xSemaphoreGive(mutex);
+}
+
+#endif
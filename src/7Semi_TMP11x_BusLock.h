@@ -0,0 +1,158 @@
+/**
+ * 7Semi TMP11x Bus Lock
+ *
+ * - Serializes register transactions on a shared TwoWire bus
+ * - One lock object per physical bus, shared by all sensors (and other
+ *   drivers) on that bus
+ * - Held for one complete register transaction only; retry backoff and
+ *   polling waits run unlocked
+ * - Records wait-time statistics to expose contention
+ *
+ * Implementations:
+ * - TMP11x_FreeRTOSBusLock: FreeRTOS mutex (ESP32)
+ * - No lock set (default): no locking, no overhead
+ *
+ * Notes:
+ * - Other drivers on the same bus call acquire() / release()
+ *   (or use TMP11x_BusLockGuard) around their own transactions
+ */
+
+#ifndef _7SEMI_TMP11X_BUS_LOCK_H_
+#define _7SEMI_TMP11X_BUS_LOCK_H_
+
+#include <Arduino.h>
+
+#if defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#endif
+
+/**
+ * Lock contention counters.
+ *
+ * - acquisitions: successful acquire() calls
+ * - contended: acquisitions that had to wait
+ * - timeouts: acquire() calls that gave up
+ * - totalWaitUs / maxWaitUs: wait time of contended acquisitions
+ */
+struct TMP11x_BusLockStats {
+    uint32_t acquisitions;
+    uint32_t contended;
+    uint32_t timeouts;
+    uint32_t totalWaitUs;
+    uint32_t maxWaitUs;
+};
+
+/* ================= TMP11x Bus Lock ================= */
+
+class TMP11x_BusLock {
+public:
+    /**
+     * Take the bus.
+     *
+     * - An uncontended take costs one tryLock() (no timestamping)
+     * - Returns false if the lock was not obtained within timeoutMs
+     */
+    bool acquire(uint32_t timeoutMs);
+
+    /**
+     * Release the bus.
+     */
+    void release();
+
+    /**
+     * Contention counters.
+     *
+     * - Updated while holding the lock; timeouts are approximate
+     */
+    const TMP11x_BusLockStats &stats() const;
+
+    /**
+     * Clear contention counters.
+     */
+    void resetStats();
+
+    /**
+     * Mean wait of contended acquisitions (us).
+     */
+    uint32_t averageWaitUs() const;
+
+protected:
+    TMP11x_BusLock();
+    ~TMP11x_BusLock() {}
+
+    /**
+     * Take the lock without waiting.
+     */
+    virtual bool tryLock() = 0;
+
+    /**
+     * Take the lock, waiting up to timeoutMs.
+     */
+    virtual bool lock(uint32_t timeoutMs) = 0;
+
+    /**
+     * Release the lock.
+     */
+    virtual void unlock() = 0;
+
+private:
+    TMP11x_BusLockStats lockStats;
+};
+
+/* ================= Scoped Guard ================= */
+
+/**
+ * Holds a bus lock for the lifetime of the guard.
+ *
+ * - A NULL lock is accepted (no locking)
+ * - Check locked() before using the bus
+ */
+class TMP11x_BusLockGuard {
+public:
+    TMP11x_BusLockGuard(TMP11x_BusLock *lock, uint32_t timeoutMs)
+        : busLock(lock), held(lock ? lock->acquire(timeoutMs) : true) {}
+
+    ~TMP11x_BusLockGuard() {
+        if (busLock && held)
+            busLock->release();
+    }
+
+    bool locked() const { return held; }
+
+private:
+    TMP11x_BusLock *busLock;
+    bool held;
+
+    TMP11x_BusLockGuard(const TMP11x_BusLockGuard &);
+    TMP11x_BusLockGuard &operator=(const TMP11x_BusLockGuard &);
+};
+
+#if defined(ESP32)
+
+/* ================= FreeRTOS Mutex Lock ================= */
+
+/**
+ * Bus lock backed by a statically allocated FreeRTOS mutex.
+ *
+ * - Safe to construct as a global (no heap, no scheduler needed)
+ * - Priority inheritance avoids inversion between sampling tasks
+ * - Do not use from an ISR
+ */
+class TMP11x_FreeRTOSBusLock : public TMP11x_BusLock {
+public:
+    TMP11x_FreeRTOSBusLock();
+
+protected:
+    virtual bool tryLock();
+    virtual bool lock(uint32_t timeoutMs);
+    virtual void unlock();
+
+private:
+    StaticSemaphore_t mutexBuffer;
+    SemaphoreHandle_t mutex;
+};
+
+#endif
+
+#endif
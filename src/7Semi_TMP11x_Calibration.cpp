@@ -0,0 +1,257 @@
+/**
+ * 7Semi TMP11x Multi-Point Calibration
+ *
+ * Model (r = raw code after the device applied offsetRaw()):
+ * - knots[i]: measured codes, shifted by the offset
+ * - valueQ8[i]: reference at knots[i] (raw * 256)
+ * - slopeQ16[i]: gain of segment i (valueQ8 per raw code, * 256)
+ * - corrected = valueQ8[i] + (r - knots[i]) * slopeQ16[i] / 256, rounded
+ * - Outer segments extrapolate
+ */
+
+#include "7Semi_TMP11x_Calibration.h"
+
+/* Blob layout version */
+#define CAL_BLOB_VERSION 1
+
+/* Unity gain (Q16) */
+#define CAL_UNITY_Q16 65536L
+
+TMP11x_Calibration::TMP11x_Calibration() {
+    clear();
+}
+
+/**
+ * Fit from reference readings.
+ *
+ * - Points are sorted by measured code
+ * - Offset = error at the middle point, so an uncorrected reading
+ *   (another master, no setCalibration()) is still close mid-range
+ */
+uint8_t TMP11x_Calibration::fit(const int16_t *measuredRaw,
+                                const int32_t *referenceMilliC,
+                                uint8_t count,
+                                int16_t measuredOffsetRaw) {
+    if (count == 0 || count > TMP11X_CAL_MAX_POINTS)
+        return false;
+
+    int16_t raw[TMP11X_CAL_MAX_POINTS];
+    int32_t refQ8[TMP11X_CAL_MAX_POINTS];
+
+    /* Insertion sort on measured code, offset removed */
+    for (uint8_t i = 0; i < count; i++) {
+        int16_t r = TMP11x_clampRaw((int32_t)measuredRaw[i] - measuredOffsetRaw);
+        /* m°C -> raw * 256: x * 4096 / 125 */
+        int64_t scaled = (int64_t)referenceMilliC[i] * 4096;
+        int32_t q8 = (int32_t)((scaled + (scaled >= 0 ? 62 : -62)) / 125);
+
+        uint8_t j = i;
+        while (j > 0 && raw[j - 1] > r) {
+            raw[j] = raw[j - 1];
+            refQ8[j] = refQ8[j - 1];
+            j--;
+        }
+        if (j > 0 && raw[j - 1] == r)
+            return false;
+
+        raw[j] = r;
+        refQ8[j] = q8;
+    }
+
+    /* Constant term: rounded error at the pivot */
+    uint8_t pivot = (count - 1) / 2;
+    int32_t errorQ8 = refQ8[pivot] - ((int32_t)raw[pivot] << 8);
+    int16_t newOffset = TMP11x_clampRaw((errorQ8 + 128) >> 8);
+
+    for (uint8_t i = 0; i < count; i++) {
+        knots[i] = TMP11x_clampRaw((int32_t)raw[i] + newOffset);
+        valueQ8[i] = refQ8[i];
+    }
+
+    if (count == 1) {
+        slopeQ16[0] = CAL_UNITY_Q16;
+    } else {
+        for (uint8_t i = 0; i + 1 < count; i++) {
+            int64_t dv = (int64_t)(valueQ8[i + 1] - valueQ8[i]) << 8;
+            slopeQ16[i] = (int32_t)(dv / (knots[i + 1] - knots[i]));
+        }
+        slopeQ16[count - 1] = 0;
+    }
+
+    points = count;
+    offset = newOffset;
+    return true;
+}
+
+/**
+ * Correct one raw code.
+ */
+int16_t TMP11x_Calibration::correct(int16_t rawTemperature) const {
+    if (points == 0)
+        return rawTemperature;
+
+    uint8_t i = 0;
+    while (i + 2 < points && rawTemperature >= knots[i + 1])
+        i++;
+
+    int32_t q8 = valueQ8[i] + (int32_t)(((int64_t)(rawTemperature - knots[i]) * slopeQ16[i]) >> 8);
+    return TMP11x_clampRaw((q8 + 128) >> 8);
+}
+
+/**
+ * Constant term for the TEMP_OFFSET register.
+ */
+int16_t TMP11x_Calibration::offsetRaw() const {
+    return offset;
+}
+
+/**
+ * Number of points.
+ */
+uint8_t TMP11x_Calibration::pointCount() const {
+    return points;
+}
+
+/**
+ * True if the calibration fits in EEPROM1..3.
+ */
+bool TMP11x_Calibration::isLinear() const {
+    return points <= 2;
+}
+
+/**
+ * Reset to identity.
+ */
+void TMP11x_Calibration::clear() {
+    points = 0;
+    offset = 0;
+    for (uint8_t i = 0; i < TMP11X_CAL_MAX_POINTS; i++) {
+        knots[i] = 0;
+        valueQ8[i] = 0;
+        slopeQ16[i] = 0;
+    }
+}
+
+/* ================= Device Storage ================= */
+
+/**
+ * Write the constant term to TEMP_OFFSET.
+ */
+uint8_t TMP11x_Calibration::applyOffset(TMP11x_7Semi &sensor) const {
+    return sensor.setOffsetMilliC(TMP11x_rawToMilliC(offset));
+}
+
+/**
+ * Queue TEMP_OFFSET and EEPROM1..3.
+ *
+ * - Pivot is knot 0, where fit() took the offset, so the residual
+ *   is within +-0.5 LSB
+ */
+uint8_t TMP11x_Calibration::saveToEEPROM(TMP11x_7Semi &sensor) const {
+    if (points == 0 || !isLinear())
+        return false;
+
+    int32_t gain = slopeQ16[0] - CAL_UNITY_Q16;
+    int32_t residual = valueQ8[0] - ((int32_t)knots[0] << 8);
+
+    if (gain < -32768 || gain > 32767 || residual < -128 || residual > 127)
+        return false;
+
+    uint16_t e1 = ((uint16_t)TMP11X_CAL_EEPROM_MARKER << 8) | (uint8_t)(int8_t)residual;
+
+    return sensor.queueEEPROMWrite(REG_TEMP_OFFSET, (uint16_t)offset) &&
+           sensor.queueEEPROMWrite(REG_EEPROM1, e1) &&
+           sensor.queueEEPROMWrite(REG_EEPROM2, (uint16_t)knots[0]) &&
+           sensor.queueEEPROMWrite(REG_EEPROM3, (uint16_t)(int16_t)gain);
+}
+
+/**
+ * Load a linear calibration from EEPROM1..3 and TEMP_OFFSET.
+ */
+uint8_t TMP11x_Calibration::loadFromEEPROM(TMP11x_7Semi &sensor) {
+    uint16_t e1, e2, e3;
+    int32_t offsetMilliC;
+
+    if (!sensor.readEEPROM(REG_EEPROM1, e1) ||
+        !sensor.readEEPROM(REG_EEPROM2, e2) ||
+        !sensor.readEEPROM(REG_EEPROM3, e3) ||
+        !sensor.getOffsetMilliC(offsetMilliC))
+        return false;
+
+    if ((e1 >> 8) != TMP11X_CAL_EEPROM_MARKER)
+        return false;
+
+    clear();
+    points = 1;
+    offset = TMP11x_milliCToRaw(offsetMilliC);
+    knots[0] = (int16_t)e2;
+    valueQ8[0] = ((int32_t)knots[0] << 8) + (int8_t)(e1 & 0xFF);
+    slopeQ16[0] = CAL_UNITY_Q16 + (int16_t)e3;
+    return true;
+}
+
+/* ================= Blob Storage ================= */
+
+/**
+ * Serialize into a byte blob (little endian).
+ */
+uint8_t TMP11x_Calibration::toBlob(uint8_t *blob, uint8_t size) const {
+    uint8_t length = 4 + points * 10;
+    if (size < length)
+        return 0;
+
+    blob[0] = CAL_BLOB_VERSION;
+    blob[1] = points;
+    blob[2] = (uint8_t)offset;
+    blob[3] = (uint8_t)((uint16_t)offset >> 8);
+
+    uint8_t *p = blob + 4;
+    for (uint8_t i = 0; i < points; i++) {
+        uint16_t k = (uint16_t)knots[i];
+        uint32_t v = (uint32_t)valueQ8[i];
+        uint32_t s = (uint32_t)slopeQ16[i];
+
+        for (uint8_t b = 0; b < 2; b++)
+            *p++ = (uint8_t)(k >> (8 * b));
+        for (uint8_t b = 0; b < 4; b++)
+            *p++ = (uint8_t)(v >> (8 * b));
+        for (uint8_t b = 0; b < 4; b++)
+            *p++ = (uint8_t)(s >> (8 * b));
+    }
+    return length;
+}
+
+/**
+ * Restore from a byte blob.
+ */
+uint8_t TMP11x_Calibration::fromBlob(const uint8_t *blob, uint8_t length) {
+    if (length < 4 || blob[0] != CAL_BLOB_VERSION || blob[1] > TMP11X_CAL_MAX_POINTS)
+        return false;
+
+    uint8_t n = blob[1];
+    if (length < 4 + n * 10)
+        return false;
+
+    clear();
+    points = n;
+    offset = (int16_t)(blob[2] | ((uint16_t)blob[3] << 8));
+
+    const uint8_t *p = blob + 4;
+    for (uint8_t i = 0; i < points; i++) {
+        uint16_t k = 0;
+        uint32_t v = 0;
+        uint32_t s = 0;
+
+        for (uint8_t b = 0; b < 2; b++)
+            k |= (uint16_t)(*p++) << (8 * b);
+        for (uint8_t b = 0; b < 4; b++)
+            v |= (uint32_t)(*p++) << (8 * b);
+        for (uint8_t b = 0; b < 4; b++)
+            s |= (uint32_t)(*p++) << (8 * b);
+
+        knots[i] = (int16_t)k;
+        valueQ8[i] = (int32_t)v;
+        slopeQ16[i] = (int32_t)s;
+    }
+    return true;
+}
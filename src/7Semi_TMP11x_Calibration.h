@@ -0,0 +1,141 @@
+/**
+ * 7Semi TMP11x Multi-Point Calibration
+ *
+ * - 1..5 point piecewise-linear correction of raw codes
+ * - Constant term goes to the TEMP_OFFSET register (applied by the device)
+ * - The remaining gain / shape correction runs in integer math:
+ *   one segment search, one multiply, two shifts per sample
+ * - Fitted from reference readings with fit()
+ *
+ * Storage:
+ * - Linear form (1..2 points): TEMP_OFFSET + EEPROM1..3, loaded from the
+ *   device itself (no MCU storage needed)
+ *   - EEPROM1: 0xCA marker | residual at the pivot (Q8, int8)
+ *   - EEPROM2: pivot (raw code, after offset)
+ *   - EEPROM3: gain - 1 (Q16, int16; gain 0.5 .. 1.5)
+ * - Any form: compact byte blob for user storage (toBlob() / fromBlob())
+ *
+ * Usage:
+ * - Collect readings with no calibration set on the sensor
+ * - fit(), then applyOffset() (or saveToEEPROM()), then
+ *   sensor.setCalibration(&calibration)
+ */
+
+#ifndef _7SEMI_TMP11X_CALIBRATION_H_
+#define _7SEMI_TMP11X_CALIBRATION_H_
+
+#include "7Semi_TMP11x.h"
+
+/**
+ * Maximum reference points.
+ */
+#define TMP11X_CAL_MAX_POINTS  5
+
+/**
+ * Blob size for TMP11X_CAL_MAX_POINTS points.
+ *
+ * - Header: version, count, offset (4 bytes)
+ * - Per point: knot (2), value Q8 (4), slope Q16 (4)
+ */
+#define TMP11X_CAL_BLOB_SIZE   (4 + TMP11X_CAL_MAX_POINTS * 10)
+
+/**
+ * EEPROM1 marker byte for a stored linear calibration.
+ */
+#define TMP11X_CAL_EEPROM_MARKER 0xCA
+
+/* ================= TMP11x Calibration Class ================= */
+
+class TMP11x_Calibration {
+public:
+    /**
+     * Constructor (identity, no correction).
+     */
+    TMP11x_Calibration();
+
+    /**
+     * Fit from reference readings.
+     *
+     * - measuredRaw: sensor raw codes at each point
+     * - referenceMilliC: reference thermometer at each point (m°C)
+     * - count: 1..TMP11X_CAL_MAX_POINTS, distinct measured values
+     * - measuredOffsetRaw: TEMP_OFFSET in effect while measuring
+     * - 1 point: offset only; 2 points: linear; 3..5: piecewise linear
+     * - Returns false (calibration unchanged) on invalid input
+     */
+    uint8_t fit(const int16_t *measuredRaw,
+                const int32_t *referenceMilliC,
+                uint8_t count,
+                int16_t measuredOffsetRaw = 0);
+
+    /**
+     * Correct one raw code (TEMP register value with offsetRaw() applied).
+     */
+    int16_t correct(int16_t rawTemperature) const;
+
+    /**
+     * Constant term for the TEMP_OFFSET register.
+     */
+    int16_t offsetRaw() const;
+
+    /**
+     * Number of points (0 = identity).
+     */
+    uint8_t pointCount() const;
+
+    /**
+     * True if the calibration fits in EEPROM1..3 (1..2 points).
+     */
+    bool isLinear() const;
+
+    /**
+     * Reset to identity.
+     */
+    void clear();
+
+    /* ================= Device Storage ================= */
+
+    /**
+     * Write the constant term to the live TEMP_OFFSET register.
+     */
+    uint8_t applyOffset(TMP11x_7Semi &sensor) const;
+
+    /**
+     * Queue TEMP_OFFSET and EEPROM1..3 on the sensor's EEPROM writer.
+     *
+     * - Linear calibrations only
+     * - Drive with serviceEEPROM() / flushEEPROM()
+     */
+    uint8_t saveToEEPROM(TMP11x_7Semi &sensor) const;
+
+    /**
+     * Load a linear calibration stored by saveToEEPROM().
+     *
+     * - Reads EEPROM1..3 and TEMP_OFFSET
+     * - Returns false (calibration unchanged) if no marker is present
+     */
+    uint8_t loadFromEEPROM(TMP11x_7Semi &sensor);
+
+    /* ================= Blob Storage ================= */
+
+    /**
+     * Serialize into a byte blob.
+     *
+     * - Returns bytes written (0 if size is too small)
+     */
+    uint8_t toBlob(uint8_t *blob, uint8_t size) const;
+
+    /**
+     * Restore from a byte blob.
+     */
+    uint8_t fromBlob(const uint8_t *blob, uint8_t length);
+
+private:
+    uint8_t points;
+    int16_t offset;
+    int16_t knots[TMP11X_CAL_MAX_POINTS];
+    int32_t valueQ8[TMP11X_CAL_MAX_POINTS];
+    int32_t slopeQ16[TMP11X_CAL_MAX_POINTS];
+};
+
+#endif
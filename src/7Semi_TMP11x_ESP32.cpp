@@ -0,0 +1,169 @@
+/**
+ * 7Semi TMP11x ESP32 Background Acquisition Task
+ *
+ * - Producer: acquisition task (via sensor sample sinks)
+ * - Consumers: any other task, lock-free
+ */
+
+#include "7Semi_TMP11x_ESP32.h"
+
+#if defined(ESP32)
+
+TMP11x_AcquisitionTask::TMP11x_AcquisitionTask() {
+    handle = NULL;
+    tickPeriodMs = 5;
+    running = false;
+    stopRequested = false;
+
+    for (uint8_t i = 0; i < TMP11X_SCHED_MAX_SENSORS; i++) {
+        taps[i].owner = this;
+        taps[i].id = i;
+        latestSamples[i].seq = 0;
+    }
+}
+
+/**
+ * Add a sensor before start().
+ */
+int8_t TMP11x_AcquisitionTask::add(TMP11x_7Semi &sensor, uint32_t periodMs, TMP11x_SCHED_MODE mode) {
+    if (running)
+        return -1;
+
+    int8_t id = sched.add(sensor, periodMs, mode);
+    if (id < 0)
+        return -1;
+
+    sensor.addSampleSink(taps[id]);
+    return id;
+}
+
+/**
+ * Spawn the acquisition task.
+ */
+bool TMP11x_AcquisitionTask::start(uint8_t core, uint32_t tickMs, UBaseType_t priority, uint32_t stackBytes) {
+    if (running)
+        return false;
+
+    tickPeriodMs = tickMs ? tickMs : 1;
+    stopRequested = false;
+    running = true;
+
+    if (xTaskCreatePinnedToCore(taskEntry, "tmp11x", stackBytes, this, priority, &handle, core) != pdPASS) {
+        running = false;
+        handle = NULL;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Ask the task to stop.
+ */
+void TMP11x_AcquisitionTask::stop() {
+    stopRequested = true;
+}
+
+/**
+ * True while the task is running.
+ */
+bool TMP11x_AcquisitionTask::isRunning() const {
+    return running;
+}
+
+/**
+ * Remove up to maxCount queued samples.
+ */
+uint16_t TMP11x_AcquisitionTask::drain(TMP11x_TaggedSample *out, uint16_t maxCount) {
+    return queue.drain(out, maxCount);
+}
+
+/**
+ * Latest sample of one sensor (seqlock read).
+ *
+ * - Retries while the writer is mid-update
+ */
+bool TMP11x_AcquisitionTask::latest(uint8_t sensorId, TMP11x_TaggedSample &sample) const {
+    if (sensorId >= TMP11X_SCHED_MAX_SENSORS)
+        return false;
+
+    const Latest &l = latestSamples[sensorId];
+    for (;;) {
+        uint32_t before = __atomic_load_n(&l.seq, __ATOMIC_ACQUIRE);
+        if (before == 0)
+            return false;
+        if (before & 1)
+            continue;
+
+        sample = l.sample;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+        if (__atomic_load_n(&l.seq, __ATOMIC_RELAXED) == before)
+            return true;
+    }
+}
+
+/**
+ * Samples dropped because the queue was full.
+ */
+uint32_t TMP11x_AcquisitionTask::dropped() const {
+    return queue.dropped();
+}
+
+/**
+ * Scheduler owned by the task.
+ */
+const TMP11x_Scheduler &TMP11x_AcquisitionTask::scheduler() const {
+    return sched;
+}
+
+/**
+ * Task body: tick the scheduler at a fixed rate.
+ */
+void TMP11x_AcquisitionTask::taskEntry(void *arg) {
+    TMP11x_AcquisitionTask *self = (TMP11x_AcquisitionTask *)arg;
+    TickType_t period = pdMS_TO_TICKS(self->tickPeriodMs);
+    TickType_t wake = xTaskGetTickCount();
+
+    if (period == 0)
+        period = 1;
+
+    self->sched.start(millis());
+
+    while (!self->stopRequested) {
+        self->sched.tick(millis());
+        vTaskDelayUntil(&wake, period);
+    }
+
+    self->running = false;
+    self->handle = NULL;
+    vTaskDelete(NULL);
+}
+
+/**
+ * Sample sink: forward to the owning task.
+ */
+void TMP11x_AcquisitionTask::Tap::onSample(int16_t rawTemperature, uint32_t timestampMs, uint16_t flags) {
+    (void)flags;
+    owner->publish(id, rawTemperature, timestampMs);
+}
+
+/**
+ * Publish a sample to the queue and the latest slot.
+ */
+void TMP11x_AcquisitionTask::publish(uint8_t id, int16_t raw, uint32_t timestampMs) {
+    TMP11x_TaggedSample sample;
+    sample.sensor = id;
+    sample.raw = raw;
+    sample.timestampMs = timestampMs;
+
+    Latest &l = latestSamples[id];
+    uint32_t seq = l.seq;
+    __atomic_store_n(&l.seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    l.sample = sample;
+    __atomic_store_n(&l.seq, seq + 2, __ATOMIC_RELEASE);
+
+    queue.push(sample);
+}
+
+#endif
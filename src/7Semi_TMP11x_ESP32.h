@@ -0,0 +1,146 @@
+/**
+ * 7Semi TMP11x ESP32 Background Acquisition Task
+ *
+ * - ESP32 only (FreeRTOS)
+ * - Spawns a task pinned to one core that owns the TwoWire bus and sensors
+ * - Samples are scheduled with TMP11x_Scheduler inside the task
+ * - Results are pushed into a lock-free SPSC queue with timestamps
+ * - Consumers on other cores drain batches or read the latest sample
+ *   without touching I2C
+ *
+ * Usage:
+ * - begin() / configure sensors in setup()
+ * - add() each sensor with its period and mode
+ * - start()
+ * - After start() do not call sensor methods from other tasks, unless
+ *   the sensors share a TMP11x_FreeRTOSBusLock (setBusLock())
+ */
+
+#ifndef _7SEMI_TMP11X_ESP32_H_
+#define _7SEMI_TMP11X_ESP32_H_
+
+#if defined(ESP32)
+
+#include "7Semi_TMP11x.h"
+#include "7Semi_TMP11x_Scheduler.h"
+#include "7Semi_TMP11x_Queue.h"
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+/**
+ * Queue slots (usable capacity is one less).
+ */
+#ifndef TMP11X_TASK_QUEUE_SIZE
+#define TMP11X_TASK_QUEUE_SIZE 64
+#endif
+
+/**
+ * Sample tagged with the scheduler id of its sensor.
+ */
+struct TMP11x_TaggedSample {
+    uint8_t sensor;
+    int16_t raw;
+    uint32_t timestampMs;
+};
+
+/* ================= TMP11x Acquisition Task ================= */
+
+class TMP11x_AcquisitionTask {
+public:
+    TMP11x_AcquisitionTask();
+
+    /**
+     * Add a sensor before start().
+     *
+     * - Returns scheduler id, or -1 if full / already running
+     */
+    int8_t add(TMP11x_7Semi &sensor, uint32_t periodMs, TMP11x_SCHED_MODE mode = SCHED_ONE_SHOT);
+
+    /**
+     * Spawn the acquisition task.
+     *
+     * - core: CPU core to pin to (0 keeps it off the Arduino loop core)
+     * - tickMs: scheduler tick period
+     * - priority / stackBytes: FreeRTOS task parameters
+     */
+    bool start(uint8_t core = 0,
+               uint32_t tickMs = 5,
+               UBaseType_t priority = 2,
+               uint32_t stackBytes = 4096);
+
+    /**
+     * Ask the task to stop after its current tick.
+     *
+     * - The task never stops mid-transaction
+     */
+    void stop();
+
+    /**
+     * True while the task is running.
+     */
+    bool isRunning() const;
+
+    /**
+     * Remove up to maxCount queued samples (oldest first).
+     *
+     * - Single consumer only
+     */
+    uint16_t drain(TMP11x_TaggedSample *out, uint16_t maxCount);
+
+    /**
+     * Latest sample of one sensor.
+     *
+     * - Lock-free; safe from any task
+     * - Returns false if the sensor has no sample yet
+     */
+    bool latest(uint8_t sensorId, TMP11x_TaggedSample &sample) const;
+
+    /**
+     * Samples dropped because the queue was full.
+     */
+    uint32_t dropped() const;
+
+    /**
+     * Scheduler counters (late / missed) for the task's sensors.
+     */
+    const TMP11x_Scheduler &scheduler() const;
+
+private:
+    /**
+     * Sample sink attached to each sensor.
+     */
+    class Tap : public TMP11x_SampleSink {
+    public:
+        TMP11x_AcquisitionTask *owner;
+        uint8_t id;
+
+        virtual void onSample(int16_t rawTemperature, uint32_t timestampMs, uint16_t flags);
+    };
+
+    /**
+     * Latest sample guarded by a sequence counter.
+     */
+    struct Latest {
+        uint32_t seq;
+        TMP11x_TaggedSample sample;
+    };
+
+    TMP11x_Scheduler sched;
+    TMP11x_SpscQueue<TMP11x_TaggedSample, TMP11X_TASK_QUEUE_SIZE> queue;
+    Tap taps[TMP11X_SCHED_MAX_SENSORS];
+    Latest latestSamples[TMP11X_SCHED_MAX_SENSORS];
+
+    TaskHandle_t handle;
+    uint32_t tickPeriodMs;
+    volatile bool running;
+    volatile bool stopRequested;
+
+    static void taskEntry(void *arg);
+
+    void publish(uint8_t id, int16_t raw, uint32_t timestampMs);
+};
+
+#endif
+
+#endif
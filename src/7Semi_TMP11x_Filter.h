@@ -0,0 +1,185 @@
+/**
+ * 7Semi TMP11x Software Filter
+ *
+ * - Filters fast hardware conversions on the MCU
+ *   (e.g. CONV_15P5MS + AVG_NONE) instead of using AVG_64
+ * - Shorter, tunable phase lag than the ~1 s hardware average
+ * - Attach to a sensor with addSampleSink(), or call feed() directly
+ *
+ * Filter types:
+ * - FILTER_BOXCAR: moving average over the last N samples
+ * - FILTER_MEDIAN: median of the last N samples (rejects spikes)
+ * - FILTER_IIR: first-order low-pass, alpha = 1 / 2^shift
+ *
+ * Template parameters:
+ * - N: window length for boxcar / median (1..255)
+ */
+
+#ifndef _7SEMI_TMP11X_FILTER_H_
+#define _7SEMI_TMP11X_FILTER_H_
+
+#include "7Semi_TMP11x.h"
+
+/**
+ * Software filter type.
+ */
+typedef enum {
+    FILTER_BOXCAR = 0,
+    FILTER_MEDIAN = 1,
+    FILTER_IIR    = 2
+} TMP11x_FILTER;
+
+/* ================= TMP11x Filter ================= */
+
+template <uint8_t N>
+class TMP11x_Filter : public TMP11x_SampleSink {
+public:
+    /**
+     * Constructor.
+     *
+     * - type: filter type
+     * - iirShift: IIR weight alpha = 1 / 2^iirShift (used by FILTER_IIR)
+     */
+    TMP11x_Filter(TMP11x_FILTER type = FILTER_BOXCAR, uint8_t iirShift = 2)
+        : filterType(type), shift(iirShift > 15 ? 15 : iirShift) {
+        reset();
+    }
+
+    /**
+     * Sample sink entry point.
+     */
+    virtual void onSample(int16_t rawTemperature, uint32_t timestampMs, uint16_t flags) {
+        (void)timestampMs;
+        (void)flags;
+        feed(rawTemperature);
+    }
+
+    /**
+     * Add one sample and update the filtered output.
+     */
+    void feed(int16_t rawTemperature) {
+        if (filterType == FILTER_IIR) {
+            int32_t x = (int32_t)rawTemperature << 8;
+            if (used == 0)
+                stateQ8 = x;
+            else
+                stateQ8 += (x - stateQ8) >> shift;
+            used = 1;
+            output = (int16_t)((stateQ8 + 128) >> 8);
+            return;
+        }
+
+        if (used == N)
+            sum -= window[pos];
+        else
+            used++;
+
+        window[pos] = rawTemperature;
+        sum += rawTemperature;
+        pos = (uint8_t)((pos + 1) % N);
+
+        if (filterType == FILTER_MEDIAN)
+            output = median();
+        else
+            output = (int16_t)((sum >= 0 ? sum + used / 2 : sum - used / 2) / used);
+    }
+
+    /**
+     * Filtered output (raw code).
+     *
+     * - Returns false until the first sample
+     */
+    uint8_t readFilteredRaw(int16_t &rawTemperature) const {
+        if (used == 0)
+            return false;
+        rawTemperature = output;
+        return true;
+    }
+
+    /**
+     * Filtered output in milli-degrees Celsius.
+     */
+    uint8_t readFilteredMilliC(int32_t &milliC) const {
+        int16_t raw;
+        if (!readFilteredRaw(raw))
+            return false;
+        milliC = TMP11x_rawToMilliC(raw);
+        return true;
+    }
+
+    /**
+     * Filtered output in Celsius.
+     */
+    uint8_t readFiltered(float &temperatureC) const {
+        int16_t raw;
+        if (!readFilteredRaw(raw))
+            return false;
+        temperatureC = raw * 0.0078125f;
+        return true;
+    }
+
+    /**
+     * Check whether the window is full (boxcar / median).
+     *
+     * - IIR is primed after the first sample
+     */
+    bool isPrimed() const {
+        return filterType == FILTER_IIR ? used != 0 : used == N;
+    }
+
+    /**
+     * Change filter type; clears filter state.
+     */
+    void setType(TMP11x_FILTER type) {
+        filterType = type;
+        reset();
+    }
+
+    /**
+     * Clear filter state.
+     */
+    void reset() {
+        used = 0;
+        pos = 0;
+        sum = 0;
+        stateQ8 = 0;
+        output = 0;
+    }
+
+private:
+    TMP11x_FILTER filterType;
+    uint8_t shift;
+
+    int16_t window[N];
+    uint8_t used;
+    uint8_t pos;
+    int32_t sum;
+    int32_t stateQ8;
+    int16_t output;
+
+    /**
+     * Median of the current window (insertion sort of a copy).
+     *
+     * - Even count: mean of the two middle values
+     */
+    int16_t median() const {
+        int16_t sorted[N];
+
+        for (uint8_t i = 0; i < used; i++) {
+            int16_t v = window[i];
+            uint8_t j = i;
+            while (j > 0 && sorted[j - 1] > v) {
+                sorted[j] = sorted[j - 1];
+                j--;
+            }
+            sorted[j] = v;
+        }
+
+        uint8_t mid = used / 2;
+        if (used & 1)
+            return sorted[mid];
+        return (int16_t)(((int32_t)sorted[mid - 1] + sorted[mid]) / 2);
+    }
+};
+
+#endif
@@ -0,0 +1,170 @@
+/**
+ * 7Semi TMP11x Sensor Health Monitor
+ *
+ * - Attempts = transactions + retries; failed attempts = retries + failures
+ * - Self-heating: EMA rise over the first sample of a fast-sampling run
+ */
+
+#include "7Semi_TMP11x_Health.h"
+
+TMP11x_Health::TMP11x_Health(TMP11x_7Semi &tmp, const TMP11x_HealthSettings &settings)
+    : heat(3) {
+    sensor = &tmp;
+    cfg = settings;
+    reset();
+}
+
+/**
+ * Replace the settings.
+ */
+void TMP11x_Health::setSettings(const TMP11x_HealthSettings &settings) {
+    cfg = settings;
+}
+
+/**
+ * Clear all flags and tracking state.
+ */
+void TMP11x_Health::reset() {
+    state = TMP11X_HEALTH_OK;
+    haveSample = false;
+    lastRaw = 0;
+    lastTime = 0;
+    stuckRun = 0;
+    errorRate = 0;
+    fastSampling = false;
+    fastStart = 0;
+    baselineMilliC = 0;
+    riseMilliC = 0;
+    heat.resetStats();
+    recoveries = 0;
+    recovered = false;
+    lastRecovery = 0;
+    rebaseWindow();
+}
+
+/* ================= Sample Tracking ================= */
+
+/**
+ * Sample sink entry point.
+ *
+ * - Every delivered sample is a fresh conversion (Data_Ready toggled)
+ */
+void TMP11x_Health::onSample(int16_t rawTemperature, uint32_t timestampMs, uint16_t flags) {
+    (void)flags;
+
+    bool fastRate = false;
+    if (haveSample) {
+        if (rawTemperature == lastRaw) {
+            if (stuckRun < 0xFFFF)
+                stuckRun++;
+        } else {
+            stuckRun = 0;
+        }
+        fastRate = timestampMs - lastTime <= cfg.selfHeatIntervalMs;
+    }
+
+    if (cfg.stuckSamples && stuckRun >= cfg.stuckSamples)
+        state |= TMP11X_HEALTH_STUCK;
+    else
+        state &= ~TMP11X_HEALTH_STUCK;
+
+    state &= ~TMP11X_HEALTH_STALLED;
+
+    if (!fastRate) {
+        fastSampling = false;
+        riseMilliC = 0;
+        state &= ~TMP11X_HEALTH_SELF_HEATING;
+    } else {
+        if (!fastSampling) {
+            fastSampling = true;
+            fastStart = lastTime;
+            baselineMilliC = TMP11x_rawToMilliC(lastRaw);
+            heat.resetStats();
+            heat.add(lastRaw);
+        }
+
+        heat.add(rawTemperature);
+        riseMilliC = heat.emaMilliC() - baselineMilliC;
+
+        if (riseMilliC >= (int32_t)cfg.selfHeatMilliC &&
+            timestampMs - fastStart <= cfg.selfHeatWindowMs)
+            state |= TMP11X_HEALTH_SELF_HEATING;
+    }
+
+    haveSample = true;
+    lastRaw = rawTemperature;
+    lastTime = timestampMs;
+}
+
+/* ================= Periodic Check ================= */
+
+/**
+ * Evaluate bus errors and stall.
+ */
+uint8_t TMP11x_Health::check() {
+    uint32_t now = millis();
+    const TMP11x_RetryStats &rs = sensor->getRetryStats();
+    uint32_t attempts = rs.transactions + rs.retries;
+    uint32_t failedAttempts = rs.retries + rs.failures;
+
+    /* Counters were reset by the application */
+    if (attempts < windowAttempts || failedAttempts < windowFailed)
+        rebaseWindow();
+
+    uint32_t span = attempts - windowAttempts;
+    if (span >= cfg.errorWindow && span) {
+        uint32_t rate = (failedAttempts - windowFailed) * 1000UL / span;
+        errorRate = rate > 1000 ? 1000 : (uint16_t)rate;
+
+        if (errorRate >= cfg.errorPermille)
+            state |= TMP11X_HEALTH_BUS_ERRORS;
+        else
+            state &= ~TMP11X_HEALTH_BUS_ERRORS;
+        rebaseWindow();
+    }
+
+    if (cfg.stallMs && haveSample && now - lastTime >= cfg.stallMs)
+        state |= TMP11X_HEALTH_STALLED;
+
+    if (cfg.autoRecover && (state & TMP11X_HEALTH_BUS_ERRORS) &&
+        (!recovered || now - lastRecovery >= cfg.recoverHoldoffMs)) {
+        sensor->recoverBus();
+        recoveries++;
+        recovered = true;
+        lastRecovery = now;
+        rebaseWindow();
+    }
+
+    return state;
+}
+
+/**
+ * Restart the bus error window.
+ */
+void TMP11x_Health::rebaseWindow() {
+    const TMP11x_RetryStats &rs = sensor->getRetryStats();
+    windowAttempts = rs.transactions + rs.retries;
+    windowFailed = rs.retries + rs.failures;
+}
+
+/* ================= Status ================= */
+
+uint8_t TMP11x_Health::health() const {
+    return state;
+}
+
+bool TMP11x_Health::isHealthy() const {
+    return state == TMP11X_HEALTH_OK;
+}
+
+/**
+ * Copy the health summary.
+ */
+void TMP11x_Health::report(TMP11x_HealthReport &out) const {
+    out.flags = state;
+    out.stuckRun = stuckRun;
+    out.errorPermille = errorRate;
+    out.selfHeatMilliC = fastSampling ? riseMilliC : 0;
+    out.recoveries = recoveries;
+    out.lastSampleMs = lastTime;
+}
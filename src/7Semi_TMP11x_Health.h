@@ -0,0 +1,182 @@
+/**
+ * 7Semi TMP11x Sensor Health Monitor
+ *
+ * - Sample sink plus a periodic check() that flags degrading sensors
+ *   before they fail outright
+ * - Stuck: the same raw code on many consecutive fresh conversions
+ *   (Data_Ready keeps toggling but the value does not move)
+ * - Stalled: no fresh conversion for a long time
+ * - Bus errors: failed attempts / attempts over a window, from the
+ *   sensor's retry counters (no extra bus traffic)
+ * - Self-heating: steady warming that starts when the sample interval
+ *   drops to a very fast CONV setting
+ * - Optional automatic recoverBus() on bus errors, with holdoff
+ *
+ * Usage:
+ * - sensor.addSampleSink(health)
+ * - Call health.check() from loop(), read health() / report()
+ *
+ * Notes:
+ * - Heuristics, not diagnoses: a real environmental warming step at the
+ *   moment fast sampling starts also reads as self-heating
+ * - Stuck detection needs noise; at AVG_64 in a very stable enclosure
+ *   raise stuckSamples
+ */
+
+#ifndef _7SEMI_TMP11X_HEALTH_H_
+#define _7SEMI_TMP11X_HEALTH_H_
+
+#include "7Semi_TMP11x.h"
+#include "7Semi_TMP11x_Stats.h"
+
+/**
+ * Health flag bits (health(), TMP11x_HealthReport::flags).
+ */
+#define TMP11X_HEALTH_OK            0x00
+#define TMP11X_HEALTH_STUCK         0x01
+#define TMP11X_HEALTH_STALLED       0x02
+#define TMP11X_HEALTH_BUS_ERRORS    0x04
+#define TMP11X_HEALTH_SELF_HEATING  0x08
+
+/**
+ * Health monitor settings.
+ *
+ * - stuckSamples: identical consecutive codes that flag stuck (0 = off)
+ * - stallMs: time without a fresh sample that flags stalled (0 = off)
+ * - errorWindow: attempts per bus error evaluation window
+ * - errorPermille: failed attempts per 1000 that flag bus errors
+ * - selfHeatIntervalMs: sample interval at or below which self-heating
+ *   is watched
+ * - selfHeatMilliC: smoothed rise since fast sampling began that flags
+ *   self-heating
+ * - selfHeatWindowMs: rise must happen this soon after fast sampling began
+ * - autoRecover: call recoverBus() when bus errors are flagged
+ * - recoverHoldoffMs: minimum time between automatic recoveries
+ */
+struct TMP11x_HealthSettings {
+    uint16_t stuckSamples;
+    uint32_t stallMs;
+    uint16_t errorWindow;
+    uint16_t errorPermille;
+    uint16_t selfHeatIntervalMs;
+    uint16_t selfHeatMilliC;
+    uint32_t selfHeatWindowMs;
+    bool autoRecover;
+    uint32_t recoverHoldoffMs;
+
+    constexpr TMP11x_HealthSettings(uint16_t stuck = 64,
+                                    uint32_t stall = 0,
+                                    uint16_t window = 64,
+                                    uint16_t permille = 50,
+                                    uint16_t heatInterval = 125,
+                                    uint16_t heatMilliC = 30,
+                                    uint32_t heatWindow = 10000,
+                                    bool recover = false,
+                                    uint32_t holdoff = 10000)
+        : stuckSamples(stuck), stallMs(stall), errorWindow(window), errorPermille(permille),
+          selfHeatIntervalMs(heatInterval), selfHeatMilliC(heatMilliC), selfHeatWindowMs(heatWindow),
+          autoRecover(recover), recoverHoldoffMs(holdoff) {}
+};
+
+/**
+ * Health summary.
+ *
+ * - flags: TMP11X_HEALTH_* bits
+ * - stuckRun: current run of identical raw codes
+ * - errorPermille: failed attempts per 1000 in the last full window
+ * - selfHeatMilliC: smoothed rise since fast sampling began (0 if not fast)
+ * - recoveries: automatic recoverBus() calls
+ * - lastSampleMs: timestamp of the last fresh sample
+ */
+struct TMP11x_HealthReport {
+    uint8_t flags;
+    uint16_t stuckRun;
+    uint16_t errorPermille;
+    int32_t selfHeatMilliC;
+    uint32_t recoveries;
+    uint32_t lastSampleMs;
+};
+
+/* ================= TMP11x Health Class ================= */
+
+class TMP11x_Health : public TMP11x_SampleSink {
+public:
+    /**
+     * Constructor.
+     *
+     * - sensor: sensor whose retry counters and bus are monitored
+     */
+    TMP11x_Health(TMP11x_7Semi &sensor,
+                  const TMP11x_HealthSettings &settings = TMP11x_HealthSettings());
+
+    /**
+     * Replace the settings.
+     */
+    void setSettings(const TMP11x_HealthSettings &settings);
+
+    /**
+     * Sample sink entry point: stuck and self-heating tracking.
+     */
+    virtual void onSample(int16_t rawTemperature, uint32_t timestampMs, uint16_t flags);
+
+    /**
+     * Evaluate bus errors and stall; recover the bus if enabled.
+     *
+     * - No bus traffic unless a recovery is triggered
+     *
+     * - Returns:
+     *   - current health flags
+     */
+    uint8_t check();
+
+    /**
+     * Current health flags (no evaluation, no bus traffic).
+     */
+    uint8_t health() const;
+
+    /**
+     * True if no health flag is set.
+     */
+    bool isHealthy() const;
+
+    /**
+     * Copy the health summary.
+     */
+    void report(TMP11x_HealthReport &out) const;
+
+    /**
+     * Clear all flags and tracking state.
+     */
+    void reset();
+
+private:
+    TMP11x_7Semi *sensor;
+    TMP11x_HealthSettings cfg;
+    uint8_t state;
+
+    bool haveSample;
+    int16_t lastRaw;
+    uint32_t lastTime;
+    uint16_t stuckRun;
+
+    uint32_t windowAttempts;
+    uint32_t windowFailed;
+    uint16_t errorRate;
+
+    bool fastSampling;
+    uint32_t fastStart;
+    int32_t baselineMilliC;
+    int32_t riseMilliC;
+    TMP11x_Stats heat;
+
+    uint32_t recoveries;
+    bool recovered;
+    uint32_t lastRecovery;
+
+    /**
+     * Restart the bus error window at the current counters.
+     */
+    void rebaseWindow();
+};
+
+#endif
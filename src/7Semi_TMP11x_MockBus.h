@@ -0,0 +1,178 @@
+/**
+ * 7Semi TMP11x Mock Bus
+ *
+ * - Bus policy that emulates one TMP117 register file in RAM
+ * - For host / unit tests of code built on the driver, no hardware needed
+ * - Use through TMP11x_PolicyTransport<TMP11x_MockBus>, or
+ *   TMP11x_AsyncPolicyTransport<TMP11x_MockBus> to emulate a DMA bus
+ *
+ * Behavior:
+ * - Only the configured address acknowledges
+ * - DEVICE_ID reads 0x0117; TEMP is set with setTemperatureRaw()
+ * - Reading CONFIG clears HIGH_Alert / LOW_Alert / Data_Ready,
+ *   reading TEMP clears Data_Ready
+ * - Writes keep the pointer on the written register, like the device
+ * - failNext() injects an error into the next transaction(s)
+ * - Asynchronous transfers complete after setAsyncLatency() polls
+ */
+
+#ifndef _7SEMI_TMP11X_MOCK_BUS_H_
+#define _7SEMI_TMP11X_MOCK_BUS_H_
+
+#include "7Semi_TMP11x.h"
+
+class TMP11x_MockBus {
+public:
+    explicit TMP11x_MockBus(uint8_t deviceAddress = 0x48)
+        : address(deviceAddress), pointer(REG_TEMP), reads(0), writes(0),
+          pointerWrites(0), faultCount(0), fault(TMP11X_OK),
+          asyncLatency(1), asyncPolls(0), asyncOp(ASYNC_IDLE), asyncAddress(0), asyncReg(0),
+          asyncPointer(false), asyncValue(0), asyncResult(NULL) {
+        for (uint8_t i = 0; i < 16; i++)
+            regs[i] = 0;
+        regs[REG_CONFIG] = 0x0220;
+        regs[REG_T_HIGH] = 0x6000;
+        regs[REG_T_LOW] = 0x8000;
+        regs[REG_DEVICE_ID] = 0x0117;
+    }
+
+    /* ================= Bus Policy ================= */
+
+    TMP11x_Status readRegister(uint8_t addr, uint8_t reg, bool sendPointer, uint16_t &value) {
+        TMP11x_Status error = check(addr);
+        if (error != TMP11X_OK)
+            return error;
+
+        if (sendPointer) {
+            pointer = reg & 0x0F;
+            pointerWrites++;
+        }
+
+        value = regs[pointer];
+        reads++;
+
+        if (pointer == REG_CONFIG)
+            regs[REG_CONFIG] &= ~(TMP11X_CFG_HIGH_ALERT | TMP11X_CFG_LOW_ALERT | TMP11X_CFG_DATA_READY);
+        else if (pointer == REG_TEMP)
+            regs[REG_CONFIG] &= ~TMP11X_CFG_DATA_READY;
+        return TMP11X_OK;
+    }
+
+    TMP11x_Status writeRegister(uint8_t addr, uint8_t reg, uint16_t value) {
+        TMP11x_Status error = check(addr);
+        if (error != TMP11X_OK)
+            return error;
+
+        pointer = reg & 0x0F;
+        writes++;
+
+        if (pointer == REG_CONFIG)
+            regs[REG_CONFIG] = (regs[REG_CONFIG] & TMP11X_CFG_FLAGS_MASK) | (value & TMP11X_CFG_WRITABLE_MASK);
+        else if (pointer != REG_TEMP && pointer != REG_DEVICE_ID)
+            regs[pointer] = value;
+        return TMP11X_OK;
+    }
+
+    /* ================= Asynchronous Bus Policy ================= */
+
+    TMP11x_Status startRead(uint8_t addr, uint8_t reg, bool sendPointer, uint16_t &value) {
+        if (asyncOp != ASYNC_IDLE)
+            return TMP11X_ERR_BUSY;
+        asyncOp = ASYNC_READ;
+        asyncAddress = addr;
+        asyncReg = reg;
+        asyncPointer = sendPointer;
+        asyncResult = &value;
+        asyncPolls = 0;
+        return TMP11X_OK;
+    }
+
+    TMP11x_Status startWrite(uint8_t addr, uint8_t reg, uint16_t value) {
+        if (asyncOp != ASYNC_IDLE)
+            return TMP11X_ERR_BUSY;
+        asyncOp = ASYNC_WRITE;
+        asyncAddress = addr;
+        asyncReg = reg;
+        asyncValue = value;
+        asyncPolls = 0;
+        return TMP11X_OK;
+    }
+
+    bool poll(TMP11x_Status &result) {
+        if (asyncOp == ASYNC_IDLE || ++asyncPolls < asyncLatency)
+            return false;
+
+        if (asyncOp == ASYNC_READ)
+            result = readRegister(asyncAddress, asyncReg, asyncPointer, *asyncResult);
+        else
+            result = writeRegister(asyncAddress, asyncReg, asyncValue);
+        asyncOp = ASYNC_IDLE;
+        return true;
+    }
+
+    /* ================= Test Controls ================= */
+
+    /**
+     * Number of poll() calls until an asynchronous transfer completes.
+     */
+    void setAsyncLatency(uint8_t polls) { asyncLatency = polls ? polls : 1; }
+
+    /**
+     * Set TEMP and raise Data_Ready (a finished conversion).
+     */
+    void setTemperatureRaw(int16_t raw) {
+        regs[REG_TEMP] = (uint16_t)raw;
+        regs[REG_CONFIG] |= TMP11X_CFG_DATA_READY;
+    }
+
+    /**
+     * Fail the next count transactions with error.
+     */
+    void failNext(TMP11x_Status error, uint8_t count = 1) {
+        fault = error;
+        faultCount = count;
+    }
+
+    /**
+     * Direct register access (no side effects).
+     */
+    uint16_t reg(uint8_t index) const { return regs[index & 0x0F]; }
+    void setReg(uint8_t index, uint16_t value) { regs[index & 0x0F] = value; }
+
+    /**
+     * Transaction counters.
+     */
+    uint32_t readCount() const { return reads; }
+    uint32_t writeCount() const { return writes; }
+    uint32_t pointerWriteCount() const { return pointerWrites; }
+
+private:
+    uint8_t address;
+    uint8_t pointer;
+    uint16_t regs[16];
+    uint32_t reads;
+    uint32_t writes;
+    uint32_t pointerWrites;
+    uint8_t faultCount;
+    TMP11x_Status fault;
+
+    enum { ASYNC_IDLE, ASYNC_READ, ASYNC_WRITE };
+    uint8_t asyncLatency;
+    uint8_t asyncPolls;
+    uint8_t asyncOp;
+    uint8_t asyncAddress;
+    uint8_t asyncReg;
+    bool asyncPointer;
+    uint16_t asyncValue;
+    uint16_t *asyncResult;
+
+    TMP11x_Status check(uint8_t addr) {
+        if (faultCount) {
+            faultCount--;
+            return fault;
+        }
+        return addr == address ? TMP11X_OK : TMP11X_ERR_NACK_ADDRESS;
+    }
+};
+
+#endif
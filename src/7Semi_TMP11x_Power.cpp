@@ -0,0 +1,83 @@
+/**
+ * 7Semi TMP11x Power Estimator / Duty-Cycle Planner
+ *
+ * - Charge per cycle = I_active * t_active + I_idle * t_idle
+ * - Average current = charge / cycle time
+ */
+
+#include "7Semi_TMP11x_Power.h"
+
+/**
+ * Average current in continuous mode.
+ */
+uint32_t TMP11x_continuousCurrentNA(TMP11x_CONV conv, TMP11x_AVG avg) {
+    uint32_t active = TMP11x_7Semi::activeTimeMs(avg);
+    uint32_t cycle = TMP11x_7Semi::conversionTimeMs(conv, avg);
+
+    uint64_t charge = (uint64_t)TMP11X_ACTIVE_CURRENT_NA * active +
+                      (uint64_t)TMP11X_STANDBY_CURRENT_NA * (cycle - active);
+    return (uint32_t)(charge / cycle);
+}
+
+/**
+ * Average current for shutdown + one-shot.
+ */
+uint32_t TMP11x_oneShotCurrentNA(TMP11x_AVG avg, uint32_t intervalMs) {
+    uint32_t active = TMP11x_7Semi::activeTimeMs(avg);
+
+    if (intervalMs <= active)
+        return TMP11X_ACTIVE_CURRENT_NA;
+
+    uint64_t charge = (uint64_t)TMP11X_ACTIVE_CURRENT_NA * active +
+                      (uint64_t)TMP11X_SHUTDOWN_CURRENT_NA * (intervalMs - active);
+    return (uint32_t)(charge / intervalMs);
+}
+
+/**
+ * Find the lowest-current plan for the interval.
+ */
+TMP11x_PowerPlan TMP11x_planPower(uint32_t intervalMs, TMP11x_AVG minAveraging) {
+    TMP11x_PowerPlan best;
+    best.mode = SHUTDOWN;
+    best.conversionRate = CONV_15P5MS;
+    best.averaging = minAveraging;
+    best.sampleIntervalMs = 0;
+    best.averageCurrentNA = 0xFFFFFFFFUL;
+    best.valid = false;
+
+    /* Continuous candidates: every AVG >= minimum, every CONV that fits */
+    for (uint8_t a = minAveraging; a <= AVG_64; a++) {
+        for (uint8_t c = CONV_15P5MS; c <= CONV_16S; c++) {
+            TMP11x_CONV conv = (TMP11x_CONV)c;
+            TMP11x_AVG avg = (TMP11x_AVG)a;
+            uint32_t cycle = TMP11x_7Semi::conversionTimeMs(conv, avg);
+            if (cycle > intervalMs)
+                continue;
+
+            uint32_t current = TMP11x_continuousCurrentNA(conv, avg);
+            if (current < best.averageCurrentNA) {
+                best.mode = CONTINUOUS_0;
+                best.conversionRate = conv;
+                best.averaging = avg;
+                best.sampleIntervalMs = cycle;
+                best.averageCurrentNA = current;
+                best.valid = true;
+            }
+        }
+    }
+
+    /* One-shot candidate: minimum averaging, one conversion per interval */
+    if (TMP11x_7Semi::activeTimeMs(minAveraging) <= intervalMs) {
+        uint32_t current = TMP11x_oneShotCurrentNA(minAveraging, intervalMs);
+        if (current < best.averageCurrentNA) {
+            best.mode = SHUTDOWN;
+            best.conversionRate = CONV_15P5MS;
+            best.averaging = minAveraging;
+            best.sampleIntervalMs = intervalMs;
+            best.averageCurrentNA = current;
+            best.valid = true;
+        }
+    }
+
+    return best;
+}
@@ -0,0 +1,89 @@
+/**
+ * 7Semi TMP11x Power Estimator / Duty-Cycle Planner
+ *
+ * - Estimates average sensor supply current for a configuration
+ * - Picks the most power-efficient plan for a target sample interval:
+ *   - continuous conversion with a given CONV / AVG, or
+ *   - shutdown + one-shot per interval (triggered by the MCU / scheduler)
+ *
+ * Model (TMP117 datasheet typical values, 25 °C):
+ * - Active conversion current: 135 uA
+ * - Standby current between continuous conversions: 1.25 uA
+ * - Shutdown current: 0.15 uA
+ * - Timing from TMP11x_7Semi::activeTimeMs() / conversionTimeMs()
+ * - MCU and I2C pull-up currents are not included
+ *
+ * Noise requirement:
+ * - Expressed as the minimum hardware averaging (AVG_NONE .. AVG_64)
+ */
+
+#ifndef _7SEMI_TMP11X_POWER_H_
+#define _7SEMI_TMP11X_POWER_H_
+
+#include "7Semi_TMP11x.h"
+
+/**
+ * Model currents in nA (override before including if your part differs).
+ */
+#ifndef TMP11X_ACTIVE_CURRENT_NA
+#define TMP11X_ACTIVE_CURRENT_NA   135000UL
+#endif
+
+#ifndef TMP11X_STANDBY_CURRENT_NA
+#define TMP11X_STANDBY_CURRENT_NA  1250UL
+#endif
+
+#ifndef TMP11X_SHUTDOWN_CURRENT_NA
+#define TMP11X_SHUTDOWN_CURRENT_NA 150UL
+#endif
+
+/**
+ * Power plan.
+ *
+ * - mode:
+ *   - CONTINUOUS_0: device converts on its own every conversionTimeMs
+ *   - SHUTDOWN: MCU calls startOneShot() every sampleIntervalMs
+ * - conversionRate / averaging: CONFIG fields to apply
+ * - sampleIntervalMs: interval between conversions
+ * - averageCurrentNA: estimated average sensor current (nA)
+ * - valid: false if no configuration meets the request
+ */
+struct TMP11x_PowerPlan {
+    TMP11x_MODE mode;
+    TMP11x_CONV conversionRate;
+    TMP11x_AVG averaging;
+    uint32_t sampleIntervalMs;
+    uint32_t averageCurrentNA;
+    bool valid;
+
+    /**
+     * CONFIG settings for this plan (apply with configure()).
+     */
+    TMP11x_Config config() const {
+        return TMP11x_Config(mode, conversionRate, averaging);
+    }
+};
+
+/**
+ * Average current in continuous mode (nA).
+ */
+uint32_t TMP11x_continuousCurrentNA(TMP11x_CONV conv, TMP11x_AVG avg);
+
+/**
+ * Average current for shutdown + one-shot every intervalMs (nA).
+ *
+ * - intervalMs shorter than the active time is treated as back-to-back
+ */
+uint32_t TMP11x_oneShotCurrentNA(TMP11x_AVG avg, uint32_t intervalMs);
+
+/**
+ * Find the lowest-current plan that delivers a fresh sample at least
+ * every intervalMs with at least minAveraging.
+ *
+ * - Continuous: longest CONV cycle that still fits the interval
+ * - One-shot: minAveraging, one conversion per interval
+ * - Ties prefer continuous (no MCU trigger needed)
+ */
+TMP11x_PowerPlan TMP11x_planPower(uint32_t intervalMs, TMP11x_AVG minAveraging = AVG_NONE);
+
+#endif
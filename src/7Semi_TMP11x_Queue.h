@@ -0,0 +1,97 @@
+/**
+ * 7Semi TMP11x Single-Producer / Single-Consumer Queue
+ *
+ * - Lock-free ring queue for passing samples between tasks / cores
+ * - Exactly one producer and one consumer; neither blocks
+ * - Fixed capacity (template parameter), no heap
+ *
+ * Template parameters:
+ * - T: element type (trivially copyable)
+ * - N: number of slots (usable capacity is N - 1)
+ *
+ * Notes:
+ * - Uses GCC __atomic builtins (acquire / release ordering)
+ * - When full, push() fails and the sample is counted as dropped
+ */
+
+#ifndef _7SEMI_TMP11X_QUEUE_H_
+#define _7SEMI_TMP11X_QUEUE_H_
+
+#include <Arduino.h>
+
+template <typename T, uint16_t N>
+class TMP11x_SpscQueue {
+public:
+    TMP11x_SpscQueue() : head(0), tail(0), droppedCount(0) {}
+
+    /**
+     * Producer: append one element.
+     *
+     * - Returns false if the queue is full
+     */
+    bool push(const T &item) {
+        uint16_t t = __atomic_load_n(&tail, __ATOMIC_RELAXED);
+        uint16_t nextTail = (uint16_t)((t + 1) % N);
+
+        if (nextTail == __atomic_load_n(&head, __ATOMIC_ACQUIRE)) {
+            __atomic_store_n(&droppedCount, droppedCount + 1, __ATOMIC_RELAXED);
+            return false;
+        }
+
+        slots[t] = item;
+        __atomic_store_n(&tail, nextTail, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    /**
+     * Consumer: remove the oldest element.
+     *
+     * - Returns false if the queue is empty
+     */
+    bool pop(T &item) {
+        uint16_t h = __atomic_load_n(&head, __ATOMIC_RELAXED);
+
+        if (h == __atomic_load_n(&tail, __ATOMIC_ACQUIRE))
+            return false;
+
+        item = slots[h];
+        __atomic_store_n(&head, (uint16_t)((h + 1) % N), __ATOMIC_RELEASE);
+        return true;
+    }
+
+    /**
+     * Consumer: remove up to maxCount elements.
+     *
+     * - Returns number of elements copied
+     */
+    uint16_t drain(T *out, uint16_t maxCount) {
+        uint16_t n = 0;
+        while (n < maxCount && pop(out[n]))
+            n++;
+        return n;
+    }
+
+    /**
+     * Approximate number of queued elements.
+     */
+    uint16_t count() const {
+        uint16_t h = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+        uint16_t t = __atomic_load_n(&tail, __ATOMIC_ACQUIRE);
+        return (uint16_t)((t + N - h) % N);
+    }
+
+    /**
+     * Elements rejected because the queue was full.
+     */
+    uint32_t dropped() const {
+        return __atomic_load_n(&droppedCount, __ATOMIC_RELAXED);
+    }
+
+private:
+    T slots[N];
+    uint16_t head;
+    uint16_t tail;
+    uint32_t droppedCount;
+};
+
+#endif
@@ -0,0 +1,204 @@
+/**
+ * 7Semi TMP11x Sample Ring Buffer
+ *
+ * - Fixed capacity, sized by template parameter (no heap)
+ * - Stores raw int16_t codes plus 16-bit timestamp deltas (4 bytes/sample)
+ * - Fill by attaching to a sensor with addSampleSink(), or push() directly
+ * - drain() copies out a batch in one call
+ *
+ * Template parameters:
+ * - N: capacity in samples
+ * - TICK_MS: timestamp resolution in ms (default 1)
+ *   - Gaps longer than 65535 ticks are saturated
+ *   - Use e.g. 1000 for slow logging intervals
+ *
+ * Notes:
+ * - When full, the oldest sample is overwritten (counted in overflows())
+ * - Not interrupt-safe: push from loop() context (service() does)
+ */
+
+#ifndef _7SEMI_TMP11X_RINGBUFFER_H_
+#define _7SEMI_TMP11X_RINGBUFFER_H_
+
+#include "7Semi_TMP11x.h"
+
+/**
+ * One sample with absolute timestamp.
+ */
+struct TMP11x_Sample {
+    int16_t raw;
+    uint32_t timestampMs;
+};
+
+/* ================= TMP11x Ring Buffer ================= */
+
+template <uint16_t N, uint16_t TICK_MS = 1>
+class TMP11x_RingBuffer : public TMP11x_SampleSink {
+public:
+    TMP11x_RingBuffer() {
+        clear();
+    }
+
+    /**
+     * Sample sink entry point.
+     */
+    virtual void onSample(int16_t rawTemperature, uint32_t timestampMs, uint16_t flags) {
+        (void)flags;
+        push(rawTemperature, timestampMs);
+    }
+
+    /**
+     * Append a sample.
+     *
+     * - Overwrites the oldest sample when full
+     */
+    void push(int16_t rawTemperature, uint32_t timestampMs) {
+        uint16_t delta = 0;
+
+        if (used == 0) {
+            oldestTime = timestampMs;
+            newestTime = timestampMs;
+        } else {
+            uint32_t ticks = (timestampMs - newestTime + TICK_MS / 2) / TICK_MS;
+            delta = ticks > 0xFFFF ? 0xFFFF : (uint16_t)ticks;
+            newestTime += (uint32_t)delta * TICK_MS;
+        }
+
+        if (used == N) {
+            dropOldest();
+            dropped++;
+
+            /* N == 1: the new sample becomes the oldest */
+            if (used == 0)
+                oldestTime = newestTime;
+        }
+
+        uint16_t slot = (uint16_t)((head + used) % N);
+        entries[slot].raw = rawTemperature;
+        entries[slot].delta = delta;
+        used++;
+    }
+
+    /**
+     * Remove and return the oldest sample.
+     */
+    bool pop(TMP11x_Sample &sample) {
+        if (used == 0)
+            return false;
+
+        sample.raw = entries[head].raw;
+        sample.timestampMs = oldestTime;
+        dropOldest();
+        return true;
+    }
+
+    /**
+     * Read a sample without removing it.
+     *
+     * - index 0 is the oldest sample
+     * - Walks timestamp deltas, O(index)
+     */
+    bool peek(uint16_t index, TMP11x_Sample &sample) const {
+        if (index >= used)
+            return false;
+
+        uint32_t t = oldestTime;
+        uint16_t slot = head;
+        for (uint16_t i = 0; i < index; i++) {
+            slot = next(slot);
+            t += (uint32_t)entries[slot].delta * TICK_MS;
+        }
+
+        sample.raw = entries[slot].raw;
+        sample.timestampMs = t;
+        return true;
+    }
+
+    /**
+     * Copy out and remove up to maxCount samples (oldest first).
+     *
+     * - Returns number of samples copied
+     */
+    uint16_t drain(TMP11x_Sample *out, uint16_t maxCount) {
+        uint16_t n = 0;
+        while (n < maxCount && pop(out[n]))
+            n++;
+        return n;
+    }
+
+    /**
+     * Copy out and remove up to maxCount raw codes (oldest first).
+     *
+     * - Returns number of samples copied
+     */
+    uint16_t drain(int16_t *out, uint16_t maxCount) {
+        TMP11x_Sample sample;
+        uint16_t n = 0;
+        while (n < maxCount && pop(sample))
+            out[n++] = sample.raw;
+        return n;
+    }
+
+    /**
+     * Remove all samples and reset counters.
+     */
+    void clear() {
+        head = 0;
+        used = 0;
+        oldestTime = 0;
+        newestTime = 0;
+        dropped = 0;
+    }
+
+    uint16_t count() const {
+        return used;
+    }
+
+    uint16_t capacity() const {
+        return N;
+    }
+
+    bool isEmpty() const {
+        return used == 0;
+    }
+
+    bool isFull() const {
+        return used == N;
+    }
+
+    /**
+     * Number of samples overwritten because the buffer was full.
+     */
+    uint32_t overflows() const {
+        return dropped;
+    }
+
+private:
+    struct Entry {
+        int16_t raw;
+        uint16_t delta;
+    };
+
+    Entry entries[N];
+    uint16_t head;
+    uint16_t used;
+    uint32_t oldestTime;
+    uint32_t newestTime;
+    uint32_t dropped;
+
+    static uint16_t next(uint16_t slot) {
+        return (uint16_t)((slot + 1) % N);
+    }
+
+    /**
+     * Drop the oldest entry and advance the base timestamp.
+     */
+    void dropOldest() {
+        head = next(head);
+        used--;
+        if (used)
+            oldestTime += (uint32_t)entries[head].delta * TICK_MS;
+    }
+};
+
+#endif
@@ -0,0 +1,195 @@
+/**
+ * 7Semi TMP11x Cooperative Scheduler
+ *
+ * - All time comparisons are wrap-safe (unsigned differences)
+ */
+
+#include "7Semi_TMP11x_Scheduler.h"
+
+TMP11x_Scheduler::TMP11x_Scheduler() {
+    entryCount = 0;
+    sampleCallback = NULL;
+    resetStatsFor(0, TMP11X_SCHED_MAX_SENSORS);
+}
+
+/**
+ * Add a sensor.
+ */
+int8_t TMP11x_Scheduler::add(TMP11x_7Semi &sensor, uint32_t periodMs, TMP11x_SCHED_MODE mode) {
+    if (entryCount >= TMP11X_SCHED_MAX_SENSORS || periodMs == 0)
+        return -1;
+
+    Entry &e = entries[entryCount];
+    e.sensor = &sensor;
+    e.periodMs = periodMs;
+    e.dueMs = 0;
+    e.mode = mode;
+    e.busy = false;
+    e.started = false;
+    resetStatsFor(entryCount, entryCount + 1);
+
+    return (int8_t)entryCount++;
+}
+
+/**
+ * Set callback for delivered samples.
+ */
+void TMP11x_Scheduler::setCallback(TMP11x_SchedulerCallback callback) {
+    sampleCallback = callback;
+}
+
+/**
+ * Make every sensor due at nowMs.
+ */
+void TMP11x_Scheduler::start(uint32_t nowMs) {
+    for (uint8_t i = 0; i < entryCount; i++) {
+        entries[i].dueMs = nowMs;
+        entries[i].busy = false;
+        entries[i].started = true;
+    }
+}
+
+/**
+ * Run one scheduling pass.
+ *
+ * - One-shot: idle -> trigger at due time -> poll -> fetch
+ * - Continuous: from due time, check Data_Ready each tick until a sample arrives
+ */
+void TMP11x_Scheduler::tick(uint32_t nowMs) {
+    for (uint8_t i = 0; i < entryCount; i++) {
+        Entry &e = entries[i];
+
+        if (!e.started) {
+            e.dueMs = nowMs;
+            e.started = true;
+        }
+
+        if (!e.busy) {
+            if ((int32_t)(nowMs - e.dueMs) < 0)
+                continue;
+
+            skipMissed(e, nowMs);
+
+            if (e.mode == SCHED_ONE_SHOT) {
+                if (e.sensor->startOneShot()) {
+                    e.busy = true;
+                } else {
+                    e.stats.errors++;
+                    e.dueMs += e.periodMs;
+                }
+                continue;
+            }
+
+            e.busy = true;
+        }
+
+        int16_t raw;
+        if (e.mode == SCHED_ONE_SHOT) {
+            if (!e.sensor->poll())
+                continue;
+
+            if (e.sensor->fetchRaw(raw)) {
+                complete(i, raw, nowMs);
+            } else {
+                e.stats.errors++;
+                e.busy = false;
+                e.dueMs += e.periodMs;
+            }
+        } else {
+            if (e.sensor->readRawTemperatureIfReady(raw))
+                complete(i, raw, nowMs);
+            else if (e.sensor->lastError() != TMP11X_ERR_NOT_READY)
+                e.stats.errors++;
+
+            /* Window for this period closed without a sample */
+            if (e.busy && nowMs - e.dueMs >= e.periodMs) {
+                e.busy = false;
+                skipMissed(e, nowMs);
+            }
+        }
+    }
+}
+
+/**
+ * Record a delivered sample.
+ */
+void TMP11x_Scheduler::complete(uint8_t id, int16_t raw, uint32_t nowMs) {
+    Entry &e = entries[id];
+    uint32_t lateness = nowMs - e.dueMs;
+
+    e.stats.samples++;
+    if (lateness > e.stats.maxLatenessMs)
+        e.stats.maxLatenessMs = lateness;
+    if (lateness > e.periodMs)
+        e.stats.late++;
+
+    e.busy = false;
+    e.dueMs += e.periodMs;
+    skipMissed(e, nowMs);
+
+    if (sampleCallback)
+        sampleCallback(id, raw, e.sensor->lastSampleTime());
+}
+
+/**
+ * Skip periods that have fully elapsed.
+ *
+ * - Keeps the schedule phase instead of bunching up catch-up samples
+ */
+void TMP11x_Scheduler::skipMissed(Entry &e, uint32_t nowMs) {
+    uint32_t behind = nowMs - e.dueMs;
+    if ((int32_t)behind < 0 || behind < e.periodMs)
+        return;
+
+    uint32_t periods = behind / e.periodMs;
+    e.stats.missed += periods;
+    e.dueMs += periods * e.periodMs;
+}
+
+/**
+ * Number of sensors added.
+ */
+uint8_t TMP11x_Scheduler::count() const {
+    return entryCount;
+}
+
+/**
+ * Counters for one sensor.
+ */
+const TMP11x_SchedulerStats &TMP11x_Scheduler::getStats(uint8_t id) const {
+    if (id >= entryCount)
+        id = entryCount ? entryCount - 1 : 0;
+    return entries[id].stats;
+}
+
+/**
+ * True if any sensor has late or missed samples.
+ */
+bool TMP11x_Scheduler::isOversubscribed() const {
+    for (uint8_t i = 0; i < entryCount; i++) {
+        if (entries[i].stats.late || entries[i].stats.missed)
+            return true;
+    }
+    return false;
+}
+
+/**
+ * Clear all counters.
+ */
+void TMP11x_Scheduler::resetStats() {
+    resetStatsFor(0, entryCount);
+}
+
+/**
+ * Clear counters of entries first..last-1.
+ */
+void TMP11x_Scheduler::resetStatsFor(uint8_t first, uint8_t last) {
+    for (uint8_t i = first; i < last; i++) {
+        TMP11x_SchedulerStats &s = entries[i].stats;
+        s.samples = 0;
+        s.late = 0;
+        s.missed = 0;
+        s.errors = 0;
+        s.maxLatenessMs = 0;
+    }
+}
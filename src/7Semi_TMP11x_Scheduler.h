@@ -0,0 +1,152 @@
+/**
+ * 7Semi TMP11x Cooperative Scheduler
+ *
+ * - Samples several TMP11x sensors, each with its own period and mode
+ * - Driven by a single tick(millis()) call from loop(); never blocks
+ * - One-shot mode: triggers startOneShot() at each period, collects via poll()
+ * - Continuous mode: reads only when Data_Ready reports a new sample
+ * - Reports late samples and missed periods (bus oversubscription)
+ *
+ * Deadlines:
+ * - A sample is due at the start of its period
+ * - It is late if delivered more than one period after it was due
+ * - Whole periods skipped because the previous sample was still pending
+ *   are counted as missed
+ */
+
+#ifndef _7SEMI_TMP11X_SCHEDULER_H_
+#define _7SEMI_TMP11X_SCHEDULER_H_
+
+#include "7Semi_TMP11x.h"
+
+#ifndef TMP11X_SCHED_MAX_SENSORS
+#define TMP11X_SCHED_MAX_SENSORS 8
+#endif
+
+/**
+ * Per-sensor acquisition mode.
+ *
+ * - SCHED_ONE_SHOT: shutdown between samples, one-shot per period
+ * - SCHED_CONTINUOUS: device converts on its own, read when Data_Ready
+ */
+typedef enum {
+    SCHED_ONE_SHOT   = 0,
+    SCHED_CONTINUOUS = 1
+} TMP11x_SCHED_MODE;
+
+/**
+ * Scheduler sample callback.
+ *
+ * - id: value returned by add()
+ */
+typedef void (*TMP11x_SchedulerCallback)(uint8_t id, int16_t rawTemperature, uint32_t timestampMs);
+
+/**
+ * Per-sensor scheduling counters.
+ *
+ * - samples: delivered samples
+ * - late: samples delivered more than one period after they were due
+ * - missed: periods skipped entirely
+ * - errors: failed triggers / reads
+ * - maxLatenessMs: worst delay between due time and delivery
+ */
+struct TMP11x_SchedulerStats {
+    uint32_t samples;
+    uint32_t late;
+    uint32_t missed;
+    uint32_t errors;
+    uint32_t maxLatenessMs;
+};
+
+/* ================= TMP11x Scheduler Class ================= */
+
+class TMP11x_Scheduler {
+public:
+    TMP11x_Scheduler();
+
+    /**
+     * Add a sensor.
+     *
+     * - periodMs: sample period
+     * - mode: SCHED_ONE_SHOT or SCHED_CONTINUOUS
+     *   - Configure the sensor mode (SHUTDOWN / CONTINUOUS_0) beforehand
+     *   - Enable the config cache for single-write one-shot triggers
+     *
+     * - Returns:
+     *   - id (0..TMP11X_SCHED_MAX_SENSORS-1), or -1 if full
+     */
+    int8_t add(TMP11x_7Semi &sensor, uint32_t periodMs, TMP11x_SCHED_MODE mode = SCHED_ONE_SHOT);
+
+    /**
+     * Set callback for delivered samples.
+     *
+     * - Samples also reach the sensors' sample sinks
+     */
+    void setCallback(TMP11x_SchedulerCallback callback);
+
+    /**
+     * Make every sensor due at nowMs.
+     *
+     * - Optional; sensors are otherwise due at the first tick()
+     */
+    void start(uint32_t nowMs);
+
+    /**
+     * Run one scheduling pass.
+     *
+     * - nowMs: current millis()
+     */
+    void tick(uint32_t nowMs);
+
+    /**
+     * Number of sensors added.
+     */
+    uint8_t count() const;
+
+    /**
+     * Counters for one sensor.
+     */
+    const TMP11x_SchedulerStats &getStats(uint8_t id) const;
+
+    /**
+     * True if any sensor has late or missed samples since the last reset.
+     */
+    bool isOversubscribed() const;
+
+    /**
+     * Clear all counters.
+     */
+    void resetStats();
+
+private:
+    struct Entry {
+        TMP11x_7Semi *sensor;
+        uint32_t periodMs;
+        uint32_t dueMs;
+        uint8_t mode;
+        bool busy;
+        bool started;
+        TMP11x_SchedulerStats stats;
+    };
+
+    Entry entries[TMP11X_SCHED_MAX_SENSORS];
+    uint8_t entryCount;
+    TMP11x_SchedulerCallback sampleCallback;
+
+    /**
+     * Record a delivered sample and advance to the next period.
+     */
+    void complete(uint8_t id, int16_t raw, uint32_t nowMs);
+
+    /**
+     * Skip periods that have fully elapsed.
+     */
+    void skipMissed(Entry &e, uint32_t nowMs);
+
+    /**
+     * Clear counters of entries first..last-1.
+     */
+    void resetStatsFor(uint8_t first, uint8_t last);
+};
+
+#endif
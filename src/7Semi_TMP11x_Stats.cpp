@@ -0,0 +1,240 @@
+/**
+ * 7Semi TMP11x Streaming Statistics
+ *
+ * - Exact integer sums of (raw - first sample) and its square
+ * - Mean and variance are derived on demand, so no rounding error
+ *   accumulates however many samples are added
+ */
+
+#include "7Semi_TMP11x_Stats.h"
+
+TMP11x_Stats::TMP11x_Stats(uint8_t shift) {
+    setEmaShift(shift);
+    resetStats();
+}
+
+/**
+ * Sample sink entry point.
+ */
+void TMP11x_Stats::onSample(int16_t rawTemperature, uint32_t timestampMs, uint16_t flags) {
+    (void)flags;
+    add(rawTemperature, timestampMs);
+}
+
+/**
+ * Add one timestamped sample.
+ *
+ * - Instantaneous slope = delta raw / delta t, then EMA smoothed
+ * - Samples with the same timestamp only update the other statistics
+ */
+void TMP11x_Stats::add(int16_t rawTemperature, uint32_t timestampMs) {
+    add(rawTemperature);
+
+    if (slopeSamples == 0) {
+        slopeSamples = 1;
+    } else {
+        uint32_t dt = timestampMs - lastTime;
+        if (dt == 0)
+            return;
+
+        int64_t inst = ((int64_t)(rawTemperature - lastRaw) * 256000) / (int64_t)dt;
+        if (inst > 0x3FFFFFFF)
+            inst = 0x3FFFFFFF;
+        else if (inst < -0x3FFFFFFF)
+            inst = -0x3FFFFFFF;
+        int32_t instQ8 = (int32_t)inst;
+
+        if (slopeSamples == 1) {
+            slopeQ8 = instQ8;
+            slopeSamples = 2;
+        } else {
+            slopeQ8 += (instQ8 - slopeQ8) >> emaShift;
+        }
+    }
+
+    lastRaw = rawTemperature;
+    lastTime = timestampMs;
+}
+
+/**
+ * Add one sample.
+ *
+ * - Sums are taken relative to the first sample, which keeps them small
+ *   for sensor data (deviations of a few hundred codes)
+ */
+void TMP11x_Stats::add(int16_t rawTemperature) {
+    int32_t x = (int32_t)rawTemperature << 8;
+
+    n++;
+    if (n == 1) {
+        minRaw = rawTemperature;
+        maxRaw = rawTemperature;
+        baseRaw = rawTemperature;
+        sumDelta = 0;
+        sumSqDelta = 0;
+        emaQ8 = x;
+        return;
+    }
+
+    if (rawTemperature < minRaw)
+        minRaw = rawTemperature;
+    if (rawTemperature > maxRaw)
+        maxRaw = rawTemperature;
+
+    int32_t d = (int32_t)rawTemperature - baseRaw;
+    sumDelta += d;
+    sumSqDelta += (uint64_t)((int64_t)d * d);
+
+    emaQ8 += (x - emaQ8) >> emaShift;
+}
+
+/**
+ * Copy the current statistics.
+ */
+void TMP11x_Stats::snapshot(TMP11x_StatsSnapshot &out) const {
+    uint64_t var = varianceQ16() >> 8;
+
+    out.count = n;
+    out.minRaw = minRaw;
+    out.maxRaw = maxRaw;
+    out.meanQ8 = meanQ8();
+    out.varianceQ8 = var > 0xFFFFFFFFUL ? 0xFFFFFFFFUL : (uint32_t)var;
+    out.emaQ8 = emaQ8;
+    out.slopeQ8 = slopeQ8;
+}
+
+/**
+ * Clear all statistics.
+ */
+void TMP11x_Stats::resetStats() {
+    n = 0;
+    minRaw = 0;
+    maxRaw = 0;
+    baseRaw = 0;
+    sumDelta = 0;
+    sumSqDelta = 0;
+    emaQ8 = 0;
+    lastRaw = 0;
+    lastTime = 0;
+    slopeSamples = 0;
+    slopeQ8 = 0;
+}
+
+/**
+ * Change EMA weight.
+ */
+void TMP11x_Stats::setEmaShift(uint8_t shift) {
+    emaShift = shift > 15 ? 15 : shift;
+}
+
+/**
+ * Number of samples since the last reset.
+ */
+uint32_t TMP11x_Stats::count() const {
+    return n;
+}
+
+/* ================= Milli-Degree Helpers ================= */
+
+int32_t TMP11x_Stats::minMilliC() const {
+    return TMP11x_rawToMilliC(minRaw);
+}
+
+int32_t TMP11x_Stats::maxMilliC() const {
+    return TMP11x_rawToMilliC(maxRaw);
+}
+
+/**
+ * Q8 raw to milli-degrees: x * 125 / (16 * 256).
+ */
+int32_t TMP11x_Stats::meanMilliC() const {
+    return (int32_t)(((int64_t)meanQ8() * 125 + 2048) >> 12);
+}
+
+int32_t TMP11x_Stats::emaMilliC() const {
+    return (int32_t)(((int64_t)emaQ8 * 125 + 2048) >> 12);
+}
+
+/**
+ * Smoothed slope in milli-degrees Celsius per second.
+ */
+int32_t TMP11x_Stats::slopeMilliCPerS() const {
+    return (int32_t)(((int64_t)slopeQ8 * 125 + 2048) >> 12);
+}
+
+/**
+ * Sample standard deviation in milli-degrees Celsius.
+ *
+ * - sqrt(variance Q16) gives raw * 256
+ */
+uint32_t TMP11x_Stats::stdDevMilliC() const {
+    uint32_t sdQ8 = isqrt(varianceQ16());
+    return (uint32_t)(((uint64_t)sdQ8 * 125 + 2048) >> 12);
+}
+
+/**
+ * Check whether readings are stable.
+ */
+bool TMP11x_Stats::isSettled(uint32_t maxStdDevMilliC, uint32_t minCount) const {
+    if (n < minCount || n < 2)
+        return false;
+    return stdDevMilliC() <= maxStdDevMilliC;
+}
+
+/**
+ * Mean in raw * 256.
+ *
+ * - base * 256 + round(sum * 256 / n)
+ */
+int32_t TMP11x_Stats::meanQ8() const {
+    if (n == 0)
+        return 0;
+
+    int64_t num = sumDelta * 256;
+    int64_t half = (int64_t)(n / 2);
+    int64_t offset = (num >= 0 ? num + half : num - half) / (int64_t)n;
+    return ((int32_t)baseRaw << 8) + (int32_t)offset;
+}
+
+/**
+ * Sample variance (n - 1 denominator) in raw^2 * 65536.
+ *
+ * - M2 = sumSq - sum^2 / n, with the division remainder kept in Q16
+ */
+uint64_t TMP11x_Stats::varianceQ16() const {
+    if (n < 2)
+        return 0;
+
+    uint64_t absSum = (uint64_t)(sumDelta < 0 ? -sumDelta : sumDelta);
+    uint64_t square = absSum * absSum;
+    uint64_t q = square / n;
+    uint64_t r = square % n;
+
+    if (sumSqDelta <= q)
+        return 0;
+
+    uint64_t m2Q16 = ((sumSqDelta - q) << 16) - ((r << 16) + n / 2) / n;
+    return m2Q16 / (n - 1);
+}
+
+/**
+ * Integer square root (bitwise, no division).
+ */
+uint32_t TMP11x_Stats::isqrt(uint64_t value) {
+    uint64_t result = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+
+    while (bit > value)
+        bit >>= 2;
+
+    while (bit) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)result;
+}
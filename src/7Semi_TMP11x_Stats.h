@@ -0,0 +1,148 @@
+/**
+ * 7Semi TMP11x Streaming Statistics
+ *
+ * - Incremental min / max / mean / variance / EMA on raw codes
+ * - Smoothed slope (rate of change) from sample timestamps
+ * - O(1) integer math per sample (exact shifted sums), no sample history
+ * - Attach to a sensor with addSampleSink(), or call add() directly
+ *
+ * Fixed-point formats:
+ * - Q8 values are raw codes * 256 (mean, EMA; slope per second)
+ * - Variance is in raw^2 * 256
+ * - *MilliC() helpers convert to milli-degrees Celsius
+ */
+
+#ifndef _7SEMI_TMP11X_STATS_H_
+#define _7SEMI_TMP11X_STATS_H_
+
+#include "7Semi_TMP11x.h"
+
+/**
+ * Point-in-time copy of the accumulated statistics.
+ *
+ * - count: number of samples
+ * - minRaw / maxRaw: extremes (raw codes)
+ * - meanQ8: mean (raw * 256)
+ * - varianceQ8: sample variance (raw^2 * 256, saturated)
+ * - emaQ8: exponential moving average (raw * 256)
+ * - slopeQ8: smoothed rate of change (raw * 256 per second)
+ */
+struct TMP11x_StatsSnapshot {
+    uint32_t count;
+    int16_t minRaw;
+    int16_t maxRaw;
+    int32_t meanQ8;
+    uint32_t varianceQ8;
+    int32_t emaQ8;
+    int32_t slopeQ8;
+};
+
+/* ================= TMP11x Stats Class ================= */
+
+class TMP11x_Stats : public TMP11x_SampleSink {
+public:
+    /**
+     * Constructor.
+     *
+     * - emaShift: EMA weight alpha = 1 / 2^emaShift (0..15, default 3 = 1/8)
+     */
+    TMP11x_Stats(uint8_t emaShift = 3);
+
+    /**
+     * Sample sink entry point.
+     */
+    virtual void onSample(int16_t rawTemperature, uint32_t timestampMs, uint16_t flags);
+
+    /**
+     * Add one sample.
+     *
+     * - Without a timestamp the slope is left unchanged
+     */
+    void add(int16_t rawTemperature);
+
+    /**
+     * Add one timestamped sample (also updates the slope).
+     *
+     * - Slope is smoothed with the same weight as the EMA
+     */
+    void add(int16_t rawTemperature, uint32_t timestampMs);
+
+    /**
+     * Copy the current statistics.
+     */
+    void snapshot(TMP11x_StatsSnapshot &out) const;
+
+    /**
+     * Clear all statistics.
+     */
+    void resetStats();
+
+    /**
+     * Change EMA weight (alpha = 1 / 2^shift).
+     */
+    void setEmaShift(uint8_t shift);
+
+    /**
+     * Number of samples since the last reset.
+     */
+    uint32_t count() const;
+
+    /* ================= Milli-Degree Helpers ================= */
+
+    int32_t minMilliC() const;
+    int32_t maxMilliC() const;
+    int32_t meanMilliC() const;
+    int32_t emaMilliC() const;
+
+    /**
+     * Smoothed slope in milli-degrees Celsius per second.
+     *
+     * - 0 until two timestamped samples were added
+     */
+    int32_t slopeMilliCPerS() const;
+
+    /**
+     * Sample standard deviation in milli-degrees Celsius.
+     */
+    uint32_t stdDevMilliC() const;
+
+    /**
+     * Check whether readings are stable.
+     *
+     * - At least minCount samples
+     * - Standard deviation <= maxStdDevMilliC
+     */
+    bool isSettled(uint32_t maxStdDevMilliC, uint32_t minCount) const;
+
+private:
+    uint32_t n;
+    int16_t minRaw;
+    int16_t maxRaw;
+    int16_t baseRaw;
+    int64_t sumDelta;
+    uint64_t sumSqDelta;
+    int32_t emaQ8;
+    uint8_t emaShift;
+
+    int16_t lastRaw;
+    uint32_t lastTime;
+    uint8_t slopeSamples;
+    int32_t slopeQ8;
+
+    /**
+     * Mean in raw * 256 (rounded).
+     */
+    int32_t meanQ8() const;
+
+    /**
+     * Sample variance in raw^2 * 65536.
+     */
+    uint64_t varianceQ16() const;
+
+    /**
+     * Integer square root.
+     */
+    static uint32_t isqrt(uint64_t value);
+};
+
+#endif
@@ -0,0 +1,197 @@
+/**
+ * 7Semi TMP11x Binary Telemetry
+ *
+ * - LEB128 varints, zigzag-coded raw deltas
+ * - Records are built in a scratch buffer, copied only if they fit
+ */
+
+#include "7Semi_TMP11x_Telemetry.h"
+
+/**
+ * Write value as LEB128, return number of bytes.
+ */
+static uint8_t putVarint(uint8_t *out, uint32_t value) {
+    uint8_t n = 0;
+    while (value >= 0x80) {
+        out[n++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    out[n++] = (uint8_t)value;
+    return n;
+}
+
+/**
+ * Map signed to unsigned so small magnitudes stay small.
+ */
+static uint32_t zigzag(int32_t value) {
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static int32_t unzigzag(uint32_t value) {
+    return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+/* ================= Encoder ================= */
+
+TMP11x_TelemetryEncoder::TMP11x_TelemetryEncoder() {
+    data = NULL;
+    size = 0;
+    used = 0;
+    records = 0;
+    rejected = 0;
+    lastRaw = 0;
+    lastTime = 0;
+}
+
+/**
+ * Start a new batch.
+ */
+bool TMP11x_TelemetryEncoder::beginBatch(uint8_t *buffer, uint16_t capacity, uint32_t baseTimeMs) {
+    uint8_t header[TMP11X_TLM_HEADER_MAX];
+    uint8_t n = 0;
+
+    header[n++] = TMP11X_TELEMETRY_FORMAT;
+    n += putVarint(header + n, baseTimeMs);
+
+    data = NULL;
+    used = 0;
+    records = 0;
+    if (!buffer || capacity < n)
+        return false;
+
+    memcpy(buffer, header, n);
+    data = buffer;
+    size = capacity;
+    used = n;
+    lastRaw = 0;
+    lastTime = baseTimeMs;
+    return true;
+}
+
+/**
+ * Append one sample.
+ */
+bool TMP11x_TelemetryEncoder::add(int16_t rawTemperature, uint32_t timestampMs, uint16_t flags) {
+    if (!data)
+        return false;
+
+    uint8_t record[TMP11X_TLM_RECORD_MAX];
+    uint8_t n = 0;
+
+    record[n++] = (uint8_t)(flags >> 13) & (TMP11X_TLM_FLAG_DATA_READY |
+                                            TMP11X_TLM_FLAG_LOW_ALERT |
+                                            TMP11X_TLM_FLAG_HIGH_ALERT);
+    n += putVarint(record + n, zigzag((int32_t)rawTemperature - lastRaw));
+    n += putVarint(record + n, timestampMs - lastTime);
+
+    if ((uint16_t)(size - used) < n)
+        return false;
+
+    memcpy(data + used, record, n);
+    used += n;
+    records++;
+    lastRaw = rawTemperature;
+    lastTime = timestampMs;
+    return true;
+}
+
+/**
+ * Sample sink entry point.
+ */
+void TMP11x_TelemetryEncoder::onSample(int16_t rawTemperature, uint32_t timestampMs, uint16_t flags) {
+    if (!add(rawTemperature, timestampMs, flags))
+        rejected++;
+}
+
+uint16_t TMP11x_TelemetryEncoder::length() const {
+    return used;
+}
+
+uint16_t TMP11x_TelemetryEncoder::count() const {
+    return records;
+}
+
+uint32_t TMP11x_TelemetryEncoder::dropped() const {
+    return rejected;
+}
+
+/* ================= Decoder ================= */
+
+TMP11x_TelemetryDecoder::TMP11x_TelemetryDecoder() {
+    data = NULL;
+    size = 0;
+    pos = 0;
+    base = 0;
+    lastRaw = 0;
+    lastTime = 0;
+}
+
+/**
+ * Start reading a batch.
+ */
+bool TMP11x_TelemetryDecoder::begin(const uint8_t *buffer, uint16_t length) {
+    data = buffer;
+    size = length;
+    pos = 0;
+
+    if (!buffer || length < 2 || buffer[0] != TMP11X_TELEMETRY_FORMAT) {
+        size = 0;
+        return false;
+    }
+
+    pos = 1;
+    if (!readVarint(base)) {
+        size = 0;
+        return false;
+    }
+
+    lastRaw = 0;
+    lastTime = base;
+    return true;
+}
+
+/**
+ * Read the next record.
+ */
+bool TMP11x_TelemetryDecoder::next(TMP11x_Sample &sample, uint8_t &flags) {
+    if (pos >= size)
+        return false;
+
+    uint16_t start = pos;
+    uint8_t f = data[pos++];
+    uint32_t delta;
+    uint32_t dt;
+
+    if (!readVarint(delta) || !readVarint(dt)) {
+        pos = start;
+        return false;
+    }
+
+    lastRaw = (int16_t)(lastRaw + unzigzag(delta));
+    lastTime += dt;
+
+    sample.raw = lastRaw;
+    sample.timestampMs = lastTime;
+    flags = f;
+    return true;
+}
+
+uint32_t TMP11x_TelemetryDecoder::baseTime() const {
+    return base;
+}
+
+/**
+ * Read one LEB128 varint (at most 5 bytes).
+ */
+bool TMP11x_TelemetryDecoder::readVarint(uint32_t &value) {
+    value = 0;
+    for (uint8_t shift = 0; shift < 35; shift += 7) {
+        if (pos >= size)
+            return false;
+        uint8_t b = data[pos++];
+        value |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80))
+            return true;
+    }
+    return false;
+}
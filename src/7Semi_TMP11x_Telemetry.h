@@ -0,0 +1,166 @@
+/**
+ * 7Semi TMP11x Binary Telemetry
+ *
+ * - Packs raw samples, timestamps and status flags into a compact
+ *   byte stream for radio / serial links (typically 3 bytes/sample)
+ * - TMP11x_TelemetryEncoder writes into a caller-provided buffer;
+ *   fill it as a sample sink, with add(), or straight from a ring buffer
+ * - TMP11x_TelemetryDecoder reads a batch back (gateway side)
+ *
+ * Batch format:
+ * - Header: format byte (TMP11X_TELEMETRY_FORMAT), varint base time (ms)
+ * - Records, until the end of the payload:
+ *   - flags byte (TMP11X_TLM_FLAG_*)
+ *   - zigzag varint: raw code minus previous raw code (first: minus 0)
+ *   - varint: timestamp minus previous timestamp (first: minus base time)
+ * - Varints are LEB128: 7 bits per byte, least significant first,
+ *   bit 7 set on all but the last byte
+ * - zigzag(d) = (d << 1) ^ (d >> 31), so small +/- deltas stay 1 byte
+ *
+ * Notes:
+ * - Records are never split; add() fails when one does not fit
+ * - Payload length must be carried by the link (no record count)
+ */
+
+#ifndef _7SEMI_TMP11X_TELEMETRY_H_
+#define _7SEMI_TMP11X_TELEMETRY_H_
+
+#include "7Semi_TMP11x.h"
+#include "7Semi_TMP11x_RingBuffer.h"
+
+/**
+ * Batch format identifier (first byte of every batch).
+ */
+#define TMP11X_TELEMETRY_FORMAT 0x71
+
+/**
+ * Record flag bits (CONFIG[15:13] >> 13).
+ */
+#define TMP11X_TLM_FLAG_DATA_READY  0x01
+#define TMP11X_TLM_FLAG_LOW_ALERT   0x02
+#define TMP11X_TLM_FLAG_HIGH_ALERT  0x04
+
+/**
+ * Worst-case sizes in bytes.
+ */
+#define TMP11X_TLM_HEADER_MAX  6
+#define TMP11X_TLM_RECORD_MAX  9
+
+/* ================= TMP11x Telemetry Encoder ================= */
+
+class TMP11x_TelemetryEncoder : public TMP11x_SampleSink {
+public:
+    TMP11x_TelemetryEncoder();
+
+    /**
+     * Start a new batch in buffer.
+     *
+     * - baseTimeMs: reference time, usually the first sample timestamp
+     * - Fails if capacity cannot hold the header
+     */
+    bool beginBatch(uint8_t *buffer, uint16_t capacity, uint32_t baseTimeMs);
+
+    /**
+     * Append one sample.
+     *
+     * - flags: CONFIG-style flags (TMP11X_CFG_*), as passed to sample sinks
+     * - Returns false if no batch is open or the record does not fit
+     */
+    bool add(int16_t rawTemperature, uint32_t timestampMs, uint16_t flags = TMP11X_CFG_DATA_READY);
+
+    /**
+     * Sample sink entry point.
+     *
+     * - Samples that do not fit are counted in dropped()
+     */
+    virtual void onSample(int16_t rawTemperature, uint32_t timestampMs, uint16_t flags);
+
+    /**
+     * Move samples from a ring buffer into the batch (oldest first).
+     *
+     * - Samples stay in the ring buffer once the batch is full
+     * - Ring buffers keep no flags; records carry Data_Ready only
+     *
+     * - Returns:
+     *   - number of samples encoded
+     */
+    template <uint16_t N, uint16_t TICK_MS>
+    uint16_t addFrom(TMP11x_RingBuffer<N, TICK_MS> &ring) {
+        TMP11x_Sample sample;
+        uint16_t n = 0;
+
+        while (ring.peek(0, sample) && add(sample.raw, sample.timestampMs)) {
+            ring.pop(sample);
+            n++;
+        }
+        return n;
+    }
+
+    /**
+     * Bytes written to the current batch (header included).
+     */
+    uint16_t length() const;
+
+    /**
+     * Records in the current batch.
+     */
+    uint16_t count() const;
+
+    /**
+     * Samples rejected by onSample() because the batch was full.
+     */
+    uint32_t dropped() const;
+
+private:
+    uint8_t *data;
+    uint16_t size;
+    uint16_t used;
+    uint16_t records;
+    uint32_t rejected;
+
+    int16_t lastRaw;
+    uint32_t lastTime;
+};
+
+/* ================= TMP11x Telemetry Decoder ================= */
+
+class TMP11x_TelemetryDecoder {
+public:
+    TMP11x_TelemetryDecoder();
+
+    /**
+     * Start reading a batch.
+     *
+     * - Fails on an unknown format byte or a truncated header
+     */
+    bool begin(const uint8_t *buffer, uint16_t length);
+
+    /**
+     * Read the next record.
+     *
+     * - flags: TMP11X_TLM_FLAG_* bits
+     * - Returns false at the end of the batch or on a truncated record
+     */
+    bool next(TMP11x_Sample &sample, uint8_t &flags);
+
+    /**
+     * Base time from the batch header.
+     */
+    uint32_t baseTime() const;
+
+private:
+    const uint8_t *data;
+    uint16_t size;
+    uint16_t pos;
+    uint32_t base;
+
+    int16_t lastRaw;
+    uint32_t lastTime;
+
+    /**
+     * Read one LEB128 varint.
+     */
+    bool readVarint(uint32_t &value);
+};
+
+#endif
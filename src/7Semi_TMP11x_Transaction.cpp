@@ -0,0 +1,237 @@
+/**
+ * 7Semi TMP11x Transaction Queue
+ *
+ * - Circular queue, head is the running transaction
+ * - Asynchronous transfers hold the sensor's bus lock until completion
+ * - Failed attempts go through the sensor's retry policy
+ */
+
+#include "7Semi_TMP11x_Transaction.h"
+
+/* Transaction kinds */
+#define TXN_READ      0
+#define TXN_WRITE     1
+#define TXN_ONE_SHOT  2
+#define TXN_SAMPLE    3
+
+TMP11x_TransactionQueue::TMP11x_TransactionQueue() {
+    head = 0;
+    count = 0;
+    inFlight = false;
+    active = NULL;
+    completed = 0;
+    failed = 0;
+}
+
+/* ================= Enqueue ================= */
+
+/**
+ * Queue a register read.
+ */
+uint8_t TMP11x_TransactionQueue::enqueueRead(TMP11x_7Semi &sensor, uint8_t reg,
+                                             TMP11x_TransactionCallback callback) {
+    return push(sensor, TXN_READ, reg, 0, callback);
+}
+
+/**
+ * Queue a register write.
+ */
+uint8_t TMP11x_TransactionQueue::enqueueWrite(TMP11x_7Semi &sensor, uint8_t reg, uint16_t value,
+                                              TMP11x_TransactionCallback callback) {
+    return push(sensor, TXN_WRITE, reg, value, callback);
+}
+
+/**
+ * Queue a one-shot trigger.
+ */
+uint8_t TMP11x_TransactionQueue::enqueueOneShot(TMP11x_7Semi &sensor,
+                                                TMP11x_TransactionCallback callback) {
+    return push(sensor, TXN_ONE_SHOT, REG_CONFIG, 0, callback);
+}
+
+/**
+ * Queue a temperature sample read.
+ */
+uint8_t TMP11x_TransactionQueue::enqueueReadTemperature(TMP11x_7Semi &sensor,
+                                                        TMP11x_TransactionCallback callback) {
+    return push(sensor, TXN_SAMPLE, REG_TEMP, 0, callback);
+}
+
+/**
+ * Append one transaction.
+ */
+uint8_t TMP11x_TransactionQueue::push(TMP11x_7Semi &sensor, uint8_t op, uint8_t reg, uint16_t value,
+                                      TMP11x_TransactionCallback callback) {
+    if (reg > REG_DEVICE_ID)
+        return sensor.fail(TMP11X_ERR_INVALID_ARG);
+    if (count >= TMP11X_TXN_QUEUE_SIZE)
+        return sensor.fail(TMP11X_ERR_BUSY);
+
+    Transaction &t = queue[(head + count) % TMP11X_TXN_QUEUE_SIZE];
+    t.sensor = &sensor;
+    t.callback = callback;
+    t.value = value;
+    t.reg = reg;
+    t.op = op;
+    t.attempt = 0;
+    count++;
+    return true;
+}
+
+/* ================= Execution ================= */
+
+/**
+ * Run queued transactions.
+ */
+uint8_t TMP11x_TransactionQueue::service() {
+    uint8_t done = 0;
+
+    while (count) {
+        Transaction &t = queue[head];
+
+        if (!inFlight) {
+            if (!dispatch(t))
+                done++;
+            continue;
+        }
+
+        TMP11x_Status result;
+        if (!active->poll(result))
+            break;
+
+        inFlight = false;
+        t.sensor->unlockBus();
+
+        if (result != TMP11X_OK && retry(t, result))
+            continue;
+
+        complete(result);
+        done++;
+    }
+    return done;
+}
+
+/**
+ * Start the head transaction.
+ *
+ * - No asynchronous transport: runs readReg() / writeReg() directly
+ */
+bool TMP11x_TransactionQueue::dispatch(Transaction &t) {
+    TMP11x_7Semi &s = *t.sensor;
+    bool write = t.op == TXN_WRITE || t.op == TXN_ONE_SHOT;
+
+    if (t.op == TXN_ONE_SHOT && t.attempt == 0 && !s.prepareOneShot(t.value)) {
+        complete(s.status);
+        return false;
+    }
+
+    TMP11x_AsyncTransport *bus = s.transport ? s.transport->asyncTransport() : NULL;
+    if (!bus) {
+        uint8_t ok = write ? s.writeReg(t.reg, t.value) : s.readReg(t.reg, t.value);
+        complete(ok ? TMP11X_OK : s.status);
+        return false;
+    }
+
+    if (t.attempt == 0)
+        s.retryStats.transactions++;
+
+    for (;;) {
+        if (!s.lockBus()) {
+            if (retry(t, s.status))
+                continue;
+            complete(s.status);
+            return false;
+        }
+
+        bool sendPointer = s.needsPointer(t.reg);
+        TMP11x_Status error = write ? bus->startWrite(s.address, t.reg, t.value)
+                                    : bus->startRead(s.address, t.reg, sendPointer, t.value);
+        if (error == TMP11X_OK) {
+            active = bus;
+            inFlight = true;
+            return true;
+        }
+
+        s.unlockBus();
+        if (!retry(t, error)) {
+            complete(error);
+            return false;
+        }
+    }
+}
+
+/**
+ * Record a failed attempt.
+ */
+bool TMP11x_TransactionQueue::retry(Transaction &t, TMP11x_Status error) {
+    t.sensor->fail(error);
+    return t.sensor->retryAfterFailure(t.attempt++);
+}
+
+/**
+ * Finish the head transaction.
+ *
+ * - The slot is released before the callback, so it may enqueue more
+ */
+void TMP11x_TransactionQueue::complete(TMP11x_Status result) {
+    Transaction t = queue[head];
+    TMP11x_7Semi &s = *t.sensor;
+    bool write = t.op == TXN_WRITE || t.op == TXN_ONE_SHOT;
+
+    head = (head + 1) % TMP11X_TXN_QUEUE_SIZE;
+    count--;
+
+    if (result == TMP11X_OK) {
+        if (write) {
+            s.completeWrite(t.reg, t.value);
+        } else {
+            s.completeRead(t.reg, t.value);
+            if (t.op == TXN_SAMPLE)
+                s.completeSample((int16_t)t.value);
+        }
+        if (t.attempt)
+            s.retryStats.recovered++;
+        completed++;
+    } else {
+        s.abortTransaction(t.reg, write);
+        s.fail(result);
+        failed++;
+    }
+
+    if (t.callback)
+        t.callback(s, t.reg, t.value, result);
+}
+
+/**
+ * Run service() until the queue is empty.
+ */
+uint8_t TMP11x_TransactionQueue::flush(uint32_t timeoutMs) {
+    uint32_t start = millis();
+
+    for (;;) {
+        service();
+        if (!count)
+            return true;
+        if (millis() - start >= timeoutMs)
+            return false;
+        yield();
+    }
+}
+
+/* ================= Status ================= */
+
+uint8_t TMP11x_TransactionQueue::pending() const {
+    return count;
+}
+
+bool TMP11x_TransactionQueue::busy() const {
+    return inFlight;
+}
+
+uint32_t TMP11x_TransactionQueue::completedCount() const {
+    return completed;
+}
+
+uint32_t TMP11x_TransactionQueue::failedCount() const {
+    return failed;
+}
@@ -0,0 +1,168 @@
+/**
+ * 7Semi TMP11x Transaction Queue
+ *
+ * - Queues register reads / writes for one or more sensors and runs
+ *   them back to back from service() in loop()
+ * - Sensors on a TMP11x_AsyncTransport (DMA / interrupt-driven I2C):
+ *   one transfer in flight, service() returns while it runs, so the
+ *   CPU is free for the ~100..200 us of each register access
+ * - Sensors on Wire or a synchronous transport: the transaction runs
+ *   synchronously inside service() (same code path as direct calls)
+ * - Results are reported through a completion callback, in queue order
+ *
+ * Typical usage (sensor array):
+ * - enqueueOneShot() for every sensor
+ * - later enqueueReadTemperature() for every sensor
+ * - call service() from loop(); callbacks deliver the results
+ *
+ * Notes:
+ * - Retry policy, bus lock and pointer cache apply per sensor
+ * - Side effects match the direct calls (CONFIG cache and status
+ *   flags, calibration, one-shot state, sample sinks)
+ * - Do not call a sensor directly while it has queued transactions
+ */
+
+#ifndef _7SEMI_TMP11X_TRANSACTION_H_
+#define _7SEMI_TMP11X_TRANSACTION_H_
+
+#include "7Semi_TMP11x.h"
+#include "7Semi_TMP11x_Transport.h"
+
+#ifndef TMP11X_TXN_QUEUE_SIZE
+#define TMP11X_TXN_QUEUE_SIZE 16
+#endif
+
+/**
+ * Transaction completion callback.
+ *
+ * - sensor: sensor the transaction ran on
+ * - reg: register address
+ * - value: value read (reads) or written (writes); TEMP reads are calibrated
+ * - result: TMP11X_OK or the failure status (also in sensor.lastError())
+ */
+typedef void (*TMP11x_TransactionCallback)(TMP11x_7Semi &sensor, uint8_t reg,
+                                           uint16_t value, TMP11x_Status result);
+
+/* ================= TMP11x Transaction Queue ================= */
+
+class TMP11x_TransactionQueue {
+public:
+    TMP11x_TransactionQueue();
+
+    /**
+     * Queue a 16-bit register read.
+     *
+     * - Fails with TMP11X_ERR_INVALID_ARG for an invalid register
+     * - Fails with TMP11X_ERR_BUSY if the queue is full
+     * - Errors are reported through sensor.lastError()
+     */
+    uint8_t enqueueRead(TMP11x_7Semi &sensor, uint8_t reg,
+                        TMP11x_TransactionCallback callback = NULL);
+
+    /**
+     * Queue a 16-bit register write.
+     *
+     * - CONFIG writes update the config cache like writeConfig()
+     */
+    uint8_t enqueueWrite(TMP11x_7Semi &sensor, uint8_t reg, uint16_t value,
+                         TMP11x_TransactionCallback callback = NULL);
+
+    /**
+     * Queue a one-shot trigger (see startOneShot()).
+     *
+     * - The CONFIG word is built when the transaction runs; enable the
+     *   config cache to avoid an extra synchronous CONFIG read
+     * - Afterwards sensor.poll() / isConversionDone() track the conversion
+     */
+    uint8_t enqueueOneShot(TMP11x_7Semi &sensor,
+                           TMP11x_TransactionCallback callback = NULL);
+
+    /**
+     * Queue a temperature read that is delivered as a sample.
+     *
+     * - Calibrated raw code is passed to the sensor's sample sinks
+     * - Ends a one-shot cycle like fetchRaw()
+     */
+    uint8_t enqueueReadTemperature(TMP11x_7Semi &sensor,
+                                   TMP11x_TransactionCallback callback = NULL);
+
+    /**
+     * Run queued transactions.
+     *
+     * - Never waits for an asynchronous transfer; call again from loop()
+     * - Synchronous transactions run to completion, back to back
+     *
+     * - Returns:
+     *   - number of transactions completed during this call
+     */
+    uint8_t service();
+
+    /**
+     * Run service() until the queue is empty.
+     *
+     * - Returns false if transactions are left after timeoutMs
+     */
+    uint8_t flush(uint32_t timeoutMs = 100);
+
+    /**
+     * Number of queued transactions (including the one in flight).
+     */
+    uint8_t pending() const;
+
+    /**
+     * Check whether an asynchronous transfer is in flight.
+     */
+    bool busy() const;
+
+    /**
+     * Transactions completed successfully / failed since construction.
+     */
+    uint32_t completedCount() const;
+    uint32_t failedCount() const;
+
+private:
+    struct Transaction {
+        TMP11x_7Semi *sensor;
+        TMP11x_TransactionCallback callback;
+        uint16_t value;
+        uint8_t reg;
+        uint8_t op;
+        uint8_t attempt;
+    };
+
+    Transaction queue[TMP11X_TXN_QUEUE_SIZE];
+    uint8_t head;
+    uint8_t count;
+
+    bool inFlight;
+    TMP11x_AsyncTransport *active;
+
+    uint32_t completed;
+    uint32_t failed;
+
+    /**
+     * Append one transaction.
+     */
+    uint8_t push(TMP11x_7Semi &sensor, uint8_t op, uint8_t reg, uint16_t value,
+                 TMP11x_TransactionCallback callback);
+
+    /**
+     * Start the transaction at the head of the queue.
+     *
+     * - Returns true while an asynchronous transfer is in flight,
+     *   false once the transaction has completed
+     */
+    bool dispatch(Transaction &t);
+
+    /**
+     * Record a failed attempt and decide whether it is retried.
+     */
+    bool retry(Transaction &t, TMP11x_Status error);
+
+    /**
+     * Apply side effects, pop the head and run the callback.
+     */
+    void complete(TMP11x_Status result);
+};
+
+#endif
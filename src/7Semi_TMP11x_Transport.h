@@ -0,0 +1,170 @@
+/**
+ * 7Semi TMP11x Bus Transport
+ *
+ * - Runs the register layer over a non-Wire I2C implementation
+ *   (STM32 HAL, ESP-IDF i2c_master, DMA drivers, mocks)
+ * - TMP11x_Transport: the interface the driver calls per register attempt
+ * - TMP11x_PolicyTransport<Bus>: adapts any class with the two methods
+ *   below; costs one virtual dispatch per register access (plus the
+ *   driver's transport / Wire branch), not a zero-overhead abstraction
+ *
+ * Bus policy requirements:
+ * - TMP11x_Status readRegister(uint8_t address, uint8_t reg,
+ *                              bool sendPointer, uint16_t &value)
+ *   - sendPointer = false: the device pointer already selects reg
+ *     (pointer cache, TEMP reads only); read 2 bytes without the
+ *     pointer write
+ * - TMP11x_Status writeRegister(uint8_t address, uint8_t reg, uint16_t value)
+ * - 16-bit values are MSB first on the wire
+ *
+ * Asynchronous transports (TMP11x_AsyncTransport) additionally:
+ * - start a transfer and return immediately (DMA / interrupt-driven I2C)
+ * - report completion through poll(); used by TMP11x_TransactionQueue
+ *   (7Semi_TMP11x_Transaction.h), direct driver calls stay synchronous
+ *
+ * Notes:
+ * - Retry policy, bus lock, pointer cache and status reporting still
+ *   apply; only the byte transport is replaced
+ * - Wire stays the built-in default path (TMP11x_7Semi(TwoWire&))
+ */
+
+#ifndef _7SEMI_TMP11X_TRANSPORT_H_
+#define _7SEMI_TMP11X_TRANSPORT_H_
+
+#include "7Semi_TMP11x.h"
+
+/* ================= Transport Interface ================= */
+
+class TMP11x_AsyncTransport;
+
+class TMP11x_Transport {
+public:
+    /**
+     * Read one 16-bit register.
+     */
+    virtual TMP11x_Status readRegister(uint8_t address, uint8_t reg, bool sendPointer, uint16_t &value) = 0;
+
+    /**
+     * Write one 16-bit register.
+     */
+    virtual TMP11x_Status writeRegister(uint8_t address, uint8_t reg, uint16_t value) = 0;
+
+    /**
+     * Asynchronous interface of this transport.
+     *
+     * - NULL: synchronous only (default)
+     */
+    virtual TMP11x_AsyncTransport *asyncTransport() { return NULL; }
+
+protected:
+    TMP11x_Transport() {}
+    ~TMP11x_Transport() {}
+};
+
+/**
+ * Transport that can run one transfer in the background.
+ *
+ * - Only one transfer is in flight at a time
+ * - value (reads) must stay valid until poll() reports completion
+ * - poll() is called from the main context, never from an ISR; the
+ *   transfer-complete ISR only needs to set a flag
+ */
+class TMP11x_AsyncTransport : public TMP11x_Transport {
+public:
+    /**
+     * Start a 16-bit register read.
+     *
+     * - Returns TMP11X_OK once the transfer is started
+     */
+    virtual TMP11x_Status startRead(uint8_t address, uint8_t reg, bool sendPointer, uint16_t &value) = 0;
+
+    /**
+     * Start a 16-bit register write.
+     */
+    virtual TMP11x_Status startWrite(uint8_t address, uint8_t reg, uint16_t value) = 0;
+
+    /**
+     * Check the started transfer.
+     *
+     * - Returns true when it finished; result holds its status
+     */
+    virtual bool poll(TMP11x_Status &result) = 0;
+
+    virtual TMP11x_AsyncTransport *asyncTransport() { return this; }
+
+protected:
+    TMP11x_AsyncTransport() {}
+    ~TMP11x_AsyncTransport() {}
+};
+
+/* ================= Policy Adapter ================= */
+
+/**
+ * Transport built from a bus policy type.
+ *
+ * - Bus: class providing readRegister() / writeRegister() (see above)
+ * - The policy object is referenced, not copied
+ */
+template <class Bus>
+class TMP11x_PolicyTransport : public TMP11x_Transport {
+public:
+    explicit TMP11x_PolicyTransport(Bus &bus) : busPolicy(bus) {}
+
+    virtual TMP11x_Status readRegister(uint8_t address, uint8_t reg, bool sendPointer, uint16_t &value) {
+        return busPolicy.readRegister(address, reg, sendPointer, value);
+    }
+
+    virtual TMP11x_Status writeRegister(uint8_t address, uint8_t reg, uint16_t value) {
+        return busPolicy.writeRegister(address, reg, value);
+    }
+
+    /**
+     * Access the wrapped policy.
+     */
+    Bus &policy() { return busPolicy; }
+
+private:
+    Bus &busPolicy;
+};
+
+/**
+ * Asynchronous transport built from a bus policy type.
+ *
+ * - Bus additionally provides startRead() / startWrite() / poll() with
+ *   the TMP11x_AsyncTransport signatures
+ */
+template <class Bus>
+class TMP11x_AsyncPolicyTransport : public TMP11x_AsyncTransport {
+public:
+    explicit TMP11x_AsyncPolicyTransport(Bus &bus) : busPolicy(bus) {}
+
+    virtual TMP11x_Status readRegister(uint8_t address, uint8_t reg, bool sendPointer, uint16_t &value) {
+        return busPolicy.readRegister(address, reg, sendPointer, value);
+    }
+
+    virtual TMP11x_Status writeRegister(uint8_t address, uint8_t reg, uint16_t value) {
+        return busPolicy.writeRegister(address, reg, value);
+    }
+
+    virtual TMP11x_Status startRead(uint8_t address, uint8_t reg, bool sendPointer, uint16_t &value) {
+        return busPolicy.startRead(address, reg, sendPointer, value);
+    }
+
+    virtual TMP11x_Status startWrite(uint8_t address, uint8_t reg, uint16_t value) {
+        return busPolicy.startWrite(address, reg, value);
+    }
+
+    virtual bool poll(TMP11x_Status &result) {
+        return busPolicy.poll(result);
+    }
+
+    /**
+     * Access the wrapped policy.
+     */
+    Bus &policy() { return busPolicy; }
+
+private:
+    Bus &busPolicy;
+};
+
+#endif
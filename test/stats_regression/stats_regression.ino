@@ -0,0 +1,77 @@
+/**
+ * TMP11x_Stats Regression Test
+ *
+ * - No sensor needed; runs on any board (or a host build with the
+ *   Arduino API stubbed)
+ * - Step: 2000 samples at 3200, then 2000 at 3201
+ *   - mean 3200.5 codes, sample variance ~0.25 codes^2
+ * - Drift: 5000 samples ramping 3200..3249 in steps of 100 samples
+ * - Prints PASS / FAIL per check and a summary
+ */
+
+#include <7Semi_TMP11x.h>
+#include <7Semi_TMP11x_Stats.h>
+
+uint16_t failures = 0;
+
+void check(const char *name, bool ok) {
+  Serial.print(ok ? "PASS " : "FAIL ");
+  Serial.println(name);
+  if (!ok)
+    failures++;
+}
+
+/**
+ * |a - b| <= tolerance.
+ */
+bool near(int64_t a, int64_t b, int64_t tolerance) {
+  int64_t d = a - b;
+  return (d < 0 ? -d : d) <= tolerance;
+}
+
+void testStep() {
+  TMP11x_Stats stats;
+  for (uint16_t i = 0; i < 2000; i++)
+    stats.add(3200);
+  for (uint16_t i = 0; i < 2000; i++)
+    stats.add(3201);
+
+  TMP11x_StatsSnapshot s;
+  stats.snapshot(s);
+
+  /* 3200.5 * 256 = 819328 */
+  check("step: count", s.count == 4000);
+  check("step: mean", s.meanQ8 == 819328);
+  /* 0.25 * n / (n - 1) * 256 = 64.016 */
+  check("step: variance", near(s.varianceQ8, 64, 1));
+  check("step: min / max", s.minRaw == 3200 && s.maxRaw == 3201);
+}
+
+void testDrift() {
+  TMP11x_Stats stats;
+  int64_t sum = 0;
+  for (uint16_t i = 0; i < 5000; i++) {
+    int16_t raw = 3200 + i / 100;
+    stats.add(raw);
+    sum += raw;
+  }
+
+  TMP11x_StatsSnapshot s;
+  stats.snapshot(s);
+
+  /* Mean 3224.5; uniform steps of 1 over 50 levels: variance 208.29 (x 256 = 53323) */
+  check("drift: mean", s.meanQ8 == (int32_t)((sum * 256 + 2500) / 5000));
+  check("drift: variance", near(s.varianceQ8, 53323, 2));
+}
+
+void setup() {
+  Serial.begin(115200);
+
+  testStep();
+  testDrift();
+
+  Serial.println(failures ? "FAILED" : "ALL PASSED");
+}
+
+void loop() {
+}